@@ -1,6 +1,32 @@
 #include "parta.h"
 #include <stdlib.h>
 #include <stdio.h>
+#include <limits.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PARTA_X86 1
+#endif
+
+#ifdef PARTA_X86
+/** Whether the running CPU supports AVX2, set before main() runs */
+static int has_avx2;
+
+/**
+ * Probe the CPU at load time, so every thread only ever reads the result and
+ * no lazy initialisation can race.
+ */
+__attribute__((constructor))
+static void cpu_features_init(void) {
+    __builtin_cpu_init();
+    has_avx2 = __builtin_cpu_supports("avx2") ? 1 : 0;
+}
+
+/** Whether the running CPU supports AVX2. */
+static int cpu_has_avx2(void) {
+    return has_avx2;
+}
+#endif
 
 /**
  * Initialize an array of PCBs on the heap from an array of CPU burst times.
@@ -25,13 +51,44 @@ struct pcb* init_procs(int* bursts, int blen) {
         return NULL;
     }
 
+    return init_procs_into(procs, bursts, blen);
+}
+
+/**
+ * Initialize caller-provided storage exactly like init_procs(), so repeated
+ * runs can reuse one array (or carve it from a pcb_arena) instead of
+ * allocating.
+ *
+ * @param dst Array of at least blen PCBs.
+ * @return    dst, or NULL if dst or bursts is NULL or blen <= 0.
+ */
+struct pcb* init_procs_into(struct pcb* dst, const int* bursts, int blen) {
+    if (!dst || blen <= 0 || bursts == NULL) {
+        return NULL;
+    }
+
     for (int i = 0; i < blen; i++) {
-        procs[i].pid        = i;
+        dst[i].pid        = i;
+        dst[i].burst_left = bursts[i];
+        dst[i].wait       = 0;
+    }
+
+    return dst;
+}
+
+/**
+ * Restore PCBs built from 'bursts' to their initial state in place:
+ * burst_left = bursts[i] and wait = 0. Pids are left alone.
+ */
+void procs_reset(struct pcb* procs, const int* bursts, int plen) {
+    if (!procs || !bursts) {
+        return;
+    }
+
+    for (int i = 0; i < plen; i++) {
         procs[i].burst_left = bursts[i];
         procs[i].wait       = 0;
     }
-
-    return procs;
 }
 
 /**
@@ -89,31 +146,350 @@ void run_proc(struct pcb* procs, int plen, int current, int amount) {
     }
 }
 
+/**
+ * Allocate the arrays of a PCB table with 'len' entries.
+ *
+ * @return 0 on success, or -1 if len <= 0 or allocation fails (the table is
+ *         then left empty).
+ */
+static int pcb_table_alloc(struct pcb_table* table, int len) {
+    table->len = 0;
+    table->burst_left = NULL;
+    table->wait = NULL;
+    if (len <= 0) {
+        return -1;
+    }
+
+    table->burst_left = malloc(sizeof(int) * len);
+    table->wait = malloc(sizeof(int) * len);
+    if (!table->burst_left || !table->wait) {
+        pcb_table_free(table);
+        return -1;
+    }
+    table->len = len;
+    return 0;
+}
+
+/**
+ * Initialize a PCB table from an array of CPU burst times, like init_procs().
+ *
+ * @return 0 on success, or -1 if the arguments are invalid or allocation fails
+ *         (the table is then left empty).
+ */
+int pcb_table_init(struct pcb_table* table, const int* bursts, int blen) {
+    if (!table) {
+        return -1;
+    }
+    if (!bursts || pcb_table_alloc(table, blen) != 0) {
+        *table = (struct pcb_table){ 0 }; // safe to pcb_table_free()
+        return -1;
+    }
+
+    for (int i = 0; i < blen; i++) {
+        table->burst_left[i] = bursts[i];
+        table->wait[i] = 0;
+    }
+    return 0;
+}
+
+/**
+ * Initialize a PCB table from an existing PCB array. Entry i takes its
+ * burst_left and wait from procs[i].
+ *
+ * @return 0 on success, or -1 if the arguments are invalid or allocation fails
+ *         (the table is then left empty).
+ */
+int pcb_table_from_procs(struct pcb_table* table, const struct pcb* procs, int plen) {
+    if (!table) {
+        return -1;
+    }
+    if (!procs || pcb_table_alloc(table, plen) != 0) {
+        *table = (struct pcb_table){ 0 }; // safe to pcb_table_free()
+        return -1;
+    }
+
+    for (int i = 0; i < plen; i++) {
+        table->burst_left[i] = procs[i].burst_left;
+        table->wait[i] = procs[i].wait;
+    }
+    return 0;
+}
+
+/**
+ * Copy a PCB table back into a PCB array of table->len entries, with
+ * pid = index.
+ */
+void pcb_table_to_procs(const struct pcb_table* table, struct pcb* procs) {
+    if (!table || !procs) {
+        return;
+    }
+
+    for (int i = 0; i < table->len; i++) {
+        procs[i].pid = i;
+        procs[i].burst_left = table->burst_left[i];
+        procs[i].wait = table->wait[i];
+    }
+}
+
+void pcb_table_free(struct pcb_table* table) {
+    if (!table) {
+        return;
+    }
+    free(table->burst_left);
+    free(table->wait);
+    table->len = 0;
+    table->burst_left = NULL;
+    table->wait = NULL;
+}
+
+/** wait[i] += amount for every i in [0, len) with burst_left[i] > 0. */
+typedef void (*wait_add_fn)(int* wait, const int* burst_left, int len, int amount);
+
+static void wait_add_scalar(int* wait, const int* burst_left, int len, int amount) {
+    for (int i = 0; i < len; i++) {
+        if (burst_left[i] > 0) {
+            wait[i] += amount;
+        }
+    }
+}
+
+#ifdef __SSE2__
+static void wait_add_sse2(int* wait, const int* burst_left, int len, int amount) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i add = _mm_set1_epi32(amount);
+    int i = 0;
+    for (; i + 4 <= len; i += 4) {
+        __m128i b = _mm_loadu_si128((const __m128i*)(burst_left + i));
+        __m128i w = _mm_loadu_si128((const __m128i*)(wait + i));
+        w = _mm_add_epi32(w, _mm_and_si128(_mm_cmpgt_epi32(b, zero), add));
+        _mm_storeu_si128((__m128i*)(wait + i), w);
+    }
+    wait_add_scalar(wait + i, burst_left + i, len - i, amount);
+}
+#endif
+
+#ifdef PARTA_X86
+__attribute__((target("avx2")))
+static void wait_add_avx2(int* wait, const int* burst_left, int len, int amount) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i add = _mm256_set1_epi32(amount);
+    int i = 0;
+    for (; i + 8 <= len; i += 8) {
+        __m256i b = _mm256_loadu_si256((const __m256i*)(burst_left + i));
+        __m256i w = _mm256_loadu_si256((const __m256i*)(wait + i));
+        w = _mm256_add_epi32(w, _mm256_and_si256(_mm256_cmpgt_epi32(b, zero), add));
+        _mm256_storeu_si256((__m256i*)(wait + i), w);
+    }
+    wait_add_scalar(wait + i, burst_left + i, len - i, amount);
+}
+#endif
+
+/** Pick the widest wait_add kernel the running CPU supports. */
+static wait_add_fn wait_add_kernel(void) {
+#ifdef PARTA_X86
+    if (cpu_has_avx2()) {
+        return wait_add_avx2;
+    }
+#endif
+#ifdef __SSE2__
+    return wait_add_sse2;
+#else
+    return wait_add_scalar;
+#endif
+}
+
+/**
+ * run_proc() for a PCB table: run entry 'current' for 'amount' units and add
+ * the time actually used to the wait of every other unfinished entry.
+ *
+ * The wait update is a masked add over the whole table with the selected
+ * SIMD kernel; 'current' is then corrected if it was counted as waiting.
+ */
+void pcb_table_run_proc(struct pcb_table* table, int current, int amount) {
+    if (!table || current < 0 || current >= table->len || amount <= 0) {
+        return;
+    }
+
+    int remaining = table->burst_left[current];
+    if (remaining <= 0) {
+        return;
+    }
+
+    int used = (amount < remaining) ? amount : remaining;
+    table->burst_left[current] -= used;
+
+    wait_add_kernel()(table->wait, table->burst_left, table->len, used);
+    if (table->burst_left[current] > 0) {
+        table->wait[current] -= used;
+    }
+}
+
+/**
+ * Lazy wait accounting.
+ *
+ * Every process arrives at time 0, so a process that completes at time C
+ * after running for its whole burst b has waited exactly C - b. Rather than
+ * having run_proc() walk every PCB on every slice, the engines below keep a
+ * single clock and touch a PCB only when it is dispatched:
+ *
+ *   - lazy_begin() subtracts each unfinished process's original burst from
+ *     its wait, and
+ *   - lazy_run_proc() adds the completion time once the burst reaches 0.
+ *
+ * Between the two steps 'wait' holds an intermediate value; once the engine
+ * returns every PCB matches what the run_proc() based loop would produce.
+ */
+static void lazy_begin(struct pcb* procs, int plen) {
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            procs[i].wait -= procs[i].burst_left;
+        }
+    }
+}
+
+/**
+ * O(1) counterpart of run_proc() for engines that called lazy_begin().
+ *
+ * @param clock Simulation time at which the slice starts.
+ * @return      The time actually used (0 if the process was already done).
+ */
+static int lazy_run_proc(struct pcb* procs, int current, int amount, int clock) {
+    int remaining = procs[current].burst_left;
+    if (remaining <= 0 || amount <= 0) {
+        return 0;
+    }
+
+    int used = (amount < remaining) ? amount : remaining;
+    procs[current].burst_left -= used;
+    if (procs[current].burst_left == 0) {
+        procs[current].wait += clock + used;
+    }
+    return used;
+}
+
+/**
+ * FCFS prefix scan over procs[lo, hi) starting at time 'time'.
+ *
+ * Under FCFS every process that still has burst left waits exactly for the
+ * bursts of the unfinished processes before it, so its wait grows by the
+ * exclusive prefix sum of those bursts. Finished (burst_left <= 0) processes
+ * are skipped and left untouched, as in the run_proc() based loop.
+ *
+ * @return The time after the last process in the range completes.
+ */
+static int fcfs_scan_scalar(struct pcb* procs, int lo, int hi, int time) {
+    for (int i = lo; i < hi; i++) {
+        int burst = procs[i].burst_left;
+        if (burst <= 0) {
+            continue;
+        }
+        procs[i].wait += time;
+        procs[i].burst_left = 0;
+        time += burst;
+    }
+    return time;
+}
+
+/** Apply one block of scanned values: 'excl' is each lane's start time. */
+static void fcfs_store_block(struct pcb* procs, const int* burst, const int* excl, int lanes) {
+    for (int k = 0; k < lanes; k++) {
+        if (burst[k] > 0) {
+            procs[k].wait += excl[k];
+            procs[k].burst_left = 0;
+        }
+    }
+}
+
+#ifdef __SSE2__
+/** fcfs_scan_scalar() four PCBs at a time with an SSE2 in-register prefix sum. */
+static int fcfs_scan_sse2(struct pcb* procs, int lo, int hi, int time) {
+    __m128i carry = _mm_set1_epi32(time);
+    int i = lo;
+    for (; i + 4 <= hi; i += 4) {
+        struct pcb* p = procs + i;
+        __m128i b = _mm_set_epi32(p[3].burst_left, p[2].burst_left,
+                                  p[1].burst_left, p[0].burst_left);
+        b = _mm_and_si128(b, _mm_cmpgt_epi32(b, _mm_setzero_si128()));
+
+        __m128i x = _mm_add_epi32(b, _mm_slli_si128(b, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        __m128i excl = _mm_add_epi32(_mm_sub_epi32(x, b), carry);
+
+        int burst[4], start[4];
+        _mm_storeu_si128((__m128i*)burst, b);
+        _mm_storeu_si128((__m128i*)start, excl);
+        fcfs_store_block(p, burst, start, 4);
+
+        carry = _mm_add_epi32(carry, _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3)));
+    }
+    return fcfs_scan_scalar(procs, i, hi, _mm_cvtsi128_si32(carry));
+}
+#endif
+
+#ifdef PARTA_X86
+/** fcfs_scan_scalar() eight PCBs at a time: AVX2 strided gather and prefix sum. */
+__attribute__((target("avx2")))
+static int fcfs_scan_avx2(struct pcb* procs, int lo, int hi, int time) {
+    const int stride = sizeof(struct pcb) / sizeof(int);
+    const __m256i index = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                             _mm256_set1_epi32(stride));
+    __m256i carry = _mm256_set1_epi32(time);
+    int i = lo;
+    for (; i + 8 <= hi; i += 8) {
+        struct pcb* p = procs + i;
+        __m256i b = _mm256_i32gather_epi32(&p->burst_left, index, 4);
+        b = _mm256_max_epi32(b, _mm256_setzero_si256());
+
+        // Scan within each 128-bit half, then carry the low half into the high one.
+        __m256i x = _mm256_add_epi32(b, _mm256_slli_si256(b, 4));
+        x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+        __m256i low = _mm256_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+        x = _mm256_add_epi32(x, _mm256_permute2x128_si256(low, low, 0x08));
+        __m256i excl = _mm256_add_epi32(_mm256_sub_epi32(x, b), carry);
+
+        int burst[8], start[8];
+        _mm256_storeu_si256((__m256i*)burst, b);
+        _mm256_storeu_si256((__m256i*)start, excl);
+        fcfs_store_block(p, burst, start, 8);
+
+        carry = _mm256_add_epi32(carry, _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(7)));
+    }
+    return fcfs_scan_scalar(procs, i, hi, _mm256_cvtsi256_si32(carry));
+}
+#endif
+
+/** Below this many PCBs the vector paths are not worth their setup. */
+#define FCFS_SIMD_MIN 64
+
 /**
  * Run a First-Come-First-Serve (FCFS) schedule on the given processes.
  *
  * Starting with P0, each process runs until completion before moving on to
- * the next one. This function mutates the 'procs' array (burst_left and wait)
- * and returns the total time elapsed when all processes are done.
+ * the next one. Instead of calling run_proc() per process (O(n^2)), each
+ * wait is computed from a single prefix-sum pass over the bursts, using an
+ * AVX2 or SSE2 scan for large arrays when the CPU supports it. Processes that
+ * are already finished are skipped, as before.
+ *
+ * This function mutates the 'procs' array (burst_left and wait) and returns
+ * the total time elapsed when all processes are done.
  */
 int fcfs_run(struct pcb* procs, int plen) {
     if (!procs || plen <= 0) {
         return 0;
     }
 
-    int time = 0;
-
-    for (int i = 0; i < plen; i++) {
-        if (procs[i].burst_left <= 0) {
-            continue;
+    if (plen >= FCFS_SIMD_MIN) {
+#ifdef PARTA_X86
+        if (cpu_has_avx2()) {
+            return fcfs_scan_avx2(procs, 0, plen, 0);
         }
-
-        int amount = procs[i].burst_left;
-        run_proc(procs, plen, i, amount);
-        time += amount;
+#endif
+#ifdef __SSE2__
+        return fcfs_scan_sse2(procs, 0, plen, 0);
+#endif
     }
 
-    return time;
+    return fcfs_scan_scalar(procs, 0, plen, 0);
 }
 
 /**
@@ -184,40 +560,2140 @@ int rr_next(int current, struct pcb* procs, int plen) {
     return -1;
 }
 
+/**
+ * Build the runnable-set bitmap for the given PCBs.
+ *
+ * @return 0 on success, or -1 if the arguments are invalid or allocation fails
+ *         (in which case 'set' is left empty and may still be freed).
+ */
+int rr_bitmap_init(struct rr_bitmap* set, struct pcb* procs, int plen) {
+    if (!set) {
+        return -1;
+    }
+    set->words = NULL;
+    set->nwords = 0;
+    set->plen = 0;
+    set->runnable = 0;
+    if (!procs || plen <= 0) {
+        return -1;
+    }
+
+    int nwords = (plen + 63) / 64;
+    set->words = calloc(nwords, sizeof(uint64_t));
+    if (!set->words) {
+        return -1;
+    }
+    set->nwords = nwords;
+    set->plen = plen;
+
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            set->words[i / 64] |= UINT64_C(1) << (i % 64);
+            set->runnable++;
+        }
+    }
+    return 0;
+}
+
+void rr_bitmap_free(struct rr_bitmap* set) {
+    if (!set) {
+        return;
+    }
+    free(set->words);
+    set->words = NULL;
+    set->nwords = 0;
+    set->plen = 0;
+    set->runnable = 0;
+}
+
+/**
+ * Re-sync bit i with procs[i] after it ran: clear it once the burst is used up.
+ */
+void rr_bitmap_update(struct rr_bitmap* set, struct pcb* procs, int i) {
+    if (!set || !set->words || i < 0 || i >= set->plen) {
+        return;
+    }
+
+    uint64_t bit = UINT64_C(1) << (i % 64);
+    if (procs[i].burst_left <= 0 && (set->words[i / 64] & bit)) {
+        set->words[i / 64] &= ~bit;
+        set->runnable--;
+    }
+}
+
+/** Index of the first set bit at or after 'from', or -1 if there is none. */
+static int rr_bitmap_find(const struct rr_bitmap* set, int from) {
+    if (from >= set->plen) {
+        return -1;
+    }
+
+    int w = from / 64;
+    uint64_t word = set->words[w] & (~UINT64_C(0) << (from % 64));
+    while (1) {
+        if (word) {
+            return w * 64 + __builtin_ctzll(word);
+        }
+        if (++w >= set->nwords) {
+            return -1;
+        }
+        word = set->words[w];
+    }
+}
+
+/**
+ * Bitmap counterpart of rr_next(), following the same rules.
+ *
+ * "All done" is a check of the runnable counter, and the wrapping search is
+ * two find-first-set passes: one over (current, plen) and, failing that, one
+ * from 0, which ends at 'current' itself when it is the only runnable process.
+ */
+int rr_bitmap_next(int current, const struct rr_bitmap* set) {
+    if (!set || !set->words || set->runnable <= 0) {
+        return -1;
+    }
+
+    if (current < 0 || current >= set->plen) {
+        return rr_bitmap_find(set, 0);
+    }
+
+    int next = rr_bitmap_find(set, current + 1);
+    if (next == -1) {
+        next = rr_bitmap_find(set, 0);
+    }
+    return next;
+}
+
 /**
  * Run a Round-Robin (RR) schedule on the given processes with the given quantum.
  *
  * Each iteration:
- *  - rr_next(...) selects the next runnable process.
+ *  - The next runnable process is selected, either by rr_next(...) or by the
+ *    runnable-set bitmap, depending on 'engine'.
  *  - That process runs for min(quantum, burst_left) time units.
- *  - run_proc(...) updates burst_left and wait for all processes.
+ *  - lazy_run_proc(...) advances it against the single simulation clock;
+ *    waits are settled when each process completes (see lazy_begin()), so a
+ *    slice costs O(1) instead of run_proc()'s pass over every PCB.
  *
- * The function mutates the 'procs' array and returns the total time elapsed
- * when all processes are finished.
+ * If the bitmap cannot be allocated the scan engine is used instead. The
+ * function mutates the 'procs' array and returns the total time elapsed
+ * when all processes are finished. The resulting PCBs are identical to
+ * driving run_proc(...) slice by slice.
  */
-int rr_run(struct pcb* procs, int plen, int quantum) {
+int rr_run_engine(struct pcb* procs, int plen, int quantum, enum rr_engine engine) {
     if (!procs || plen <= 0 || quantum <= 0) {
         return 0;
     }
 
+    struct rr_bitmap set;
+    if (engine == RR_ENGINE_BITMAP && rr_bitmap_init(&set, procs, plen) != 0) {
+        engine = RR_ENGINE_SCAN;
+    }
+
     int time = 0;
     int current = -1; // previous process index for rr_next
 
+    lazy_begin(procs, plen);
+
     while (1) {
-        current = rr_next(current, procs, plen);
+        if (engine == RR_ENGINE_BITMAP) {
+            current = rr_bitmap_next(current, &set);
+        } else {
+            current = rr_next(current, procs, plen);
+        }
         if (current == -1) {
             break; // all processes finished
         }
 
-        int remaining = procs[current].burst_left;
-        if (remaining <= 0) {
-            continue;
+        time += lazy_run_proc(procs, current, quantum, time);
+        if (engine == RR_ENGINE_BITMAP) {
+            rr_bitmap_update(&set, procs, current);
         }
+    }
+
+    if (engine == RR_ENGINE_BITMAP) {
+        rr_bitmap_free(&set);
+    }
+    return time;
+}
+
+/**
+ * Run a Round-Robin (RR) schedule on the given processes with the given quantum.
+ *
+ * Uses the bitmap engine; see rr_run_engine(). Returns the total time elapsed
+ * when all processes are finished.
+ */
+int rr_run(struct pcb* procs, int plen, int quantum) {
+    return rr_run_engine(procs, plen, quantum, RR_ENGINE_BITMAP);
+}
 
-        int amount = (remaining < quantum) ? remaining : quantum;
-        run_proc(procs, plen, current, amount);
-        time += amount;
+/**
+ * Stable merge sort of the indices order[0, n) by ascending key[order[k]],
+ * through the n-entry buffer 'tmp'. Nothing is allocated.
+ */
+static void rr_sort_order(int* order, int* tmp, int n, const long long* key) {
+    for (int width = 1; width < n; width *= 2) {
+        for (int lo = 0; lo < n - width; lo += 2 * width) {
+            int mid = lo + width;
+            int hi = (mid + width < n) ? mid + width : n;
+            int x = lo, y = mid, k = lo;
+            while (x < mid && y < hi) {
+                tmp[k++] = (key[order[y]] < key[order[x]]) ? order[y++] : order[x++];
+            }
+            while (x < mid) {
+                tmp[k++] = order[x++];
+            }
+            while (y < hi) {
+                tmp[k++] = order[y++];
+            }
+            for (k = lo; k < hi; k++) {
+                order[k] = tmp[k];
+            }
+        }
     }
+}
+
+/** Working arrays of rr_completions() and its callers, for n processes */
+struct rr_work {
+    long long* burst;      /** n bursts of the unfinished processes */
+    long long* completion; /** n completion times */
+    long long* sorted;     /** n bursts, sorted */
+    long long* prefix;     /** n + 1 prefix sums of 'sorted' */
+    long long* rounds;     /** n quanta counts, ceil(burst / quantum) */
+    int* order;            /** n indices, by descending round count */
+    int* by_burst;         /** n indices, by ascending burst */
+    int* tmp;              /** n entries of merge sort buffer */
+    int* fenwick;          /** n + 1 Fenwick tree counters */
+};
+
+/**
+ * Bytes of scratch memory rr_run64_scratch() needs for 'plen' processes.
+ */
+size_t rr_scratch_size(int plen) {
+    size_t n = (plen > 0) ? (size_t)plen : 0;
+    return sizeof(long long) * (5 * n + 1) + sizeof(int) * (4 * n + 1);
+}
+
+/** Lay the working arrays for n processes out in one rr_scratch_size(n) block. */
+static void rr_work_carve(struct rr_work* w, void* scratch, int n) {
+    long long* ll = scratch;
+    w->burst = ll;
+    w->completion = ll + n;
+    w->sorted = ll + 2 * n;
+    w->prefix = ll + 3 * n;
+    w->rounds = ll + 4 * n + 1;
+    w->order = (int*)(ll + 5 * n + 1);
+    w->by_burst = w->order + n;
+    w->tmp = w->by_burst + n;
+    w->fenwick = w->tmp + n;
+}
+
+/**
+ * Compute Round-Robin completion times in closed form instead of simulating.
+ *
+ * With every process arriving at time 0 the dispatch order is fixed: round k
+ * runs, in index order, every process that needs at least k quanta. Process
+ * i, needing r = ceil(b_i / quantum) rounds, therefore completes at
+ *
+ *   C_i = b_i + sum_{j < i} min(b_j, r * quantum)
+ *             + sum_{j > i} min(b_j, (r - 1) * quantum)
+ *
+ * Using bursts sorted for the min(b_j, T) sums and a Fenwick tree over
+ * indices for the j < i correction, every C_i is found in O(n log n) total,
+ * independent of the quantum.
+ *
+ * Reads w->burst (all > 0, the unfinished processes in order) and fills
+ * w->completion; the other arrays of 'w' are scratch. Nothing is allocated.
+ *
+ * @param n Number of unfinished processes.
+ */
+static void rr_completions(struct rr_work* w, int n, int quantum) {
+    const long long* burst = w->burst;
+    long long* completion = w->completion;
+    long long* rounds_of = w->rounds;
+    long long* sorted = w->sorted;
+    long long* prefix = w->prefix;
+    int* order = w->order;
+    int* fenwick = w->fenwick;
 
+    for (int k = 0; k < n; k++) {
+        rounds_of[k] = burst[k] / quantum + (burst[k] % quantum != 0);
+        sorted[k] = -rounds_of[k]; // sort key: most rounds first
+        order[k] = k;
+        w->by_burst[k] = k;
+    }
+    for (int k = 0; k <= n; k++) {
+        fenwick[k] = 0;
+    }
+    // Stable, so processes with equal round counts stay in index order.
+    rr_sort_order(order, w->tmp, n, sorted);
+    rr_sort_order(w->by_burst, w->tmp, n, burst);
+    for (int k = 0; k < n; k++) {
+        sorted[k] = burst[w->by_burst[k]];
+    }
+    prefix[0] = 0;
+    for (int k = 0; k < n; k++) {
+        prefix[k + 1] = prefix[k] + sorted[k];
+    }
+
+    // Groups of equal round count, visited from the most rounds down, so the
+    // Fenwick tree holds exactly the processes needing more rounds than the
+    // current group. 'below' tracks how many sorted bursts are <= T.
+    int below = n;
+    for (int g = 0; g < n;) {
+        long long rounds = rounds_of[order[g]];
+        long long before = (rounds - 1) * quantum; // T
+        while (below > 0 && sorted[below - 1] > before) {
+            below--;
+        }
+        // sum over every process of min(b_j, T)
+        long long capped = prefix[below] + (long long)(n - below) * before;
+
+        int end = g;
+        long long group_extra = 0;
+        for (; end < n && rounds_of[order[end]] == rounds; end++) {
+            int i = order[end];
+
+            long long longer_before = 0; // j < i needing more rounds than i
+            for (int x = i; x > 0; x -= x & -x) {
+                longer_before += fenwick[x];
+            }
+
+            // min(b_i, T) == T is included in 'capped' and replaced by b_i.
+            completion[i] = capped - before + burst[i]
+                          + longer_before * quantum + group_extra;
+            group_extra += burst[i] - before;
+        }
+        for (int k = g; k < end; k++) {
+            for (int x = order[k] + 1; x <= n; x += x & -x) {
+                fenwick[x]++;
+            }
+        }
+        g = end;
+    }
+}
+
+/**
+ * Compute a Round-Robin (RR) schedule in closed form instead of simulating it.
+ *
+ * See rr_completions(); the cost is O(n log n) whatever the quantum.
+ *
+ * Produces exactly the same PCBs and return value as rr_run(), or returns -1
+ * with the PCBs untouched if the scratch arrays cannot be allocated, like
+ * rr_run_skip(); the caller decides whether to fall back to rr_run().
+ */
+int rr_solve(struct pcb* procs, int plen, int quantum) {
+    if (!procs || plen <= 0 || quantum <= 0) {
+        return 0;
+    }
+
+    int n = 0;
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            n++;
+        }
+    }
+    if (n == 0) {
+        return 0;
+    }
+
+    void* scratch = malloc(rr_scratch_size(n));
+    if (!scratch) {
+        return -1;
+    }
+    struct rr_work w;
+    rr_work_carve(&w, scratch, n);
+    for (int i = 0, k = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            w.burst[k++] = procs[i].burst_left;
+        }
+    }
+    rr_completions(&w, n, quantum);
+
+    long long total = 0;
+    for (int i = 0, k = 0; i < plen; i++) {
+        if (procs[i].burst_left <= 0) {
+            continue;
+        }
+        procs[i].wait += (int)(w.completion[k] - w.burst[k]);
+        procs[i].burst_left = 0;
+        total += w.burst[k];
+        k++;
+    }
+
+    free(scratch);
+    return (int)total;
+}
+
+/**
+ * Run a Round-Robin (RR) schedule by jumping from one completion to the next.
+ *
+ * With every process arriving at time 0, a round dispatches each unfinished
+ * process once, in index order. If the shortest remaining burst still needs
+ * more than k quanta, the next k rounds are all full slices, so they are
+ * applied in bulk: the clock advances by k * quantum per active process and
+ * every burst_left drops by k * quantum. The round in which the next process
+ * completes is then run slice by slice. Waits are settled as in rr_run()
+ * (see lazy_begin()), so the cost is O(n) per completion, O(n^2) at worst,
+ * however small the quantum.
+ *
+ * If 'on_dispatch' is not NULL it is called for every slice, in dispatch
+ * order, including the ones inside skipped rounds; the work done is then
+ * proportional to the length of the schedule, as in rr_run().
+ *
+ * Produces exactly the same PCBs and return value as rr_run(), or returns -1
+ * with the PCBs untouched and no callbacks made if the active list cannot be
+ * allocated; the caller decides whether to fall back to rr_run().
+ */
+int rr_run_skip(struct pcb* procs, int plen, int quantum,
+                rr_dispatch_fn on_dispatch, void* ctx) {
+    if (!procs || plen <= 0 || quantum <= 0) {
+        return 0;
+    }
+
+    int* active = malloc(sizeof(int) * plen);
+    if (!active) {
+        return -1;
+    }
+
+    int m = 0;
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            active[m++] = i;
+        }
+    }
+
+    lazy_begin(procs, plen);
+
+    int time = 0;
+    while (m > 0) {
+        int min_left = procs[active[0]].burst_left;
+        for (int a = 1; a < m; a++) {
+            if (procs[active[a]].burst_left < min_left) {
+                min_left = procs[active[a]].burst_left;
+            }
+        }
+
+        // Rounds in which nobody finishes.
+        int skip = (min_left - 1) / quantum;
+        if (skip > 0) {
+            if (on_dispatch) {
+                for (int r = 0; r < skip; r++) {
+                    for (int a = 0; a < m; a++) {
+                        on_dispatch(ctx, active[a], time, quantum);
+                        time += quantum;
+                    }
+                }
+            } else {
+                time += (int)((long long)skip * quantum * m);
+            }
+            for (int a = 0; a < m; a++) {
+                procs[active[a]].burst_left -= skip * quantum;
+            }
+        }
+
+        // The round in which at least one process completes.
+        int kept = 0;
+        for (int a = 0; a < m; a++) {
+            int i = active[a];
+            int used = lazy_run_proc(procs, i, quantum, time);
+            if (on_dispatch) {
+                on_dispatch(ctx, i, time, used);
+            }
+            time += used;
+            if (procs[i].burst_left > 0) {
+                active[kept++] = i;
+            }
+        }
+        m = kept;
+    }
+
+    free(active);
+    return time;
+}
+
+/**
+ * Initialize an array of wide-counter PCBs on the heap, like init_procs().
+ *
+ * @return Pointer to a newly allocated array of struct pcb64 of length blen,
+ *         or NULL if blen <= 0, bursts is NULL, or allocation fails.
+ */
+struct pcb64* init_procs64(const int* bursts, int blen) {
+    if (blen <= 0 || bursts == NULL) {
+        return NULL;
+    }
+
+    struct pcb64* procs = malloc(sizeof(struct pcb64) * blen);
+    if (!procs) {
+        return NULL;
+    }
+
+    return init_procs64_into(procs, bursts, blen);
+}
+
+/** Initialize caller-provided wide-counter PCBs, like init_procs_into(). */
+struct pcb64* init_procs64_into(struct pcb64* dst, const int* bursts, int blen) {
+    if (!dst || blen <= 0 || bursts == NULL) {
+        return NULL;
+    }
+
+    for (int i = 0; i < blen; i++) {
+        dst[i].pid        = i;
+        dst[i].burst_left = bursts[i];
+        dst[i].wait       = 0;
+    }
+
+    return dst;
+}
+
+/** Restore wide-counter PCBs to their initial state, like procs_reset(). */
+void procs64_reset(struct pcb64* procs, const int* bursts, int plen) {
+    if (!procs || !bursts) {
+        return;
+    }
+
+    for (int i = 0; i < plen; i++) {
+        procs[i].burst_left = bursts[i];
+        procs[i].wait       = 0;
+    }
+}
+
+/**
+ * fcfs_run() for wide-counter PCBs: a single prefix-sum pass with a 64-bit
+ * clock. Returns the total time elapsed when all processes are done.
+ */
+int64_t fcfs_run64(struct pcb64* procs, int plen) {
+    if (!procs || plen <= 0) {
+        return 0;
+    }
+
+    int64_t time = 0;
+    for (int i = 0; i < plen; i++) {
+        int64_t burst = procs[i].burst_left;
+        if (burst <= 0) {
+            continue;
+        }
+        procs[i].wait += time;
+        procs[i].burst_left = 0;
+        time += burst;
+    }
+    return time;
+}
+
+/**
+ * Slice-by-slice Round-Robin for wide-counter PCBs, used by rr_run64_scratch()
+ * when it is given no scratch memory. Waits are settled lazily (see lazy_begin()).
+ */
+static int64_t rr_run64_scan(struct pcb64* procs, int plen, int quantum) {
+    int left = 0;
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            procs[i].wait -= procs[i].burst_left;
+            left++;
+        }
+    }
+
+    int64_t time = 0;
+    int current = plen - 1;
+    while (left > 0) {
+        current = (current + 1) % plen;
+        if (procs[current].burst_left <= 0) {
+            continue;
+        }
+
+        int64_t used = (procs[current].burst_left < quantum) ? procs[current].burst_left : quantum;
+        procs[current].burst_left -= used;
+        time += used;
+        if (procs[current].burst_left == 0) {
+            procs[current].wait += time;
+            left--;
+        }
+    }
+    return time;
+}
+
+/**
+ * rr_run() for wide-counter PCBs.
+ *
+ * Computed in closed form by rr_completions(), O(n log n) whatever the
+ * quantum, so it stays fast on the workload sizes that need 64-bit counters.
+ * Its working memory is one block of rr_scratch_size(plen) bytes; see
+ * rr_run64_scratch() to supply it. Returns the total time elapsed when all
+ * processes are finished, or -1 with the PCBs untouched if that block cannot
+ * be allocated, like rr_solve().
+ */
+int64_t rr_run64(struct pcb64* procs, int plen, int quantum) {
+    if (!procs || plen <= 0 || quantum <= 0) {
+        return 0;
+    }
+
+    void* scratch = malloc(rr_scratch_size(plen));
+    if (!scratch) {
+        return -1;
+    }
+    int64_t total = rr_run64_scratch(procs, plen, quantum, scratch);
+    free(scratch);
+    return total;
+}
+
+/**
+ * rr_run64() with caller-provided working memory, so repeated runs (e.g. one
+ * per quantum of a sweep) allocate nothing.
+ *
+ * @param scratch At least rr_scratch_size(plen) bytes aligned for int64_t,
+ *                or NULL to simulate slice by slice without any memory.
+ */
+int64_t rr_run64_scratch(struct pcb64* procs, int plen, int quantum, void* scratch) {
+    if (!procs || plen <= 0 || quantum <= 0) {
+        return 0;
+    }
+    if (!scratch) {
+        return rr_run64_scan(procs, plen, quantum);
+    }
+
+    struct rr_work w;
+    rr_work_carve(&w, scratch, plen);
+    int n = 0;
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            w.burst[n++] = procs[i].burst_left;
+        }
+    }
+    if (n == 0) {
+        return 0;
+    }
+    // The arrays were laid out for plen; rr_completions() only uses the first n.
+    rr_completions(&w, n, quantum);
+
+    int64_t total = 0;
+    for (int i = 0, k = 0; i < plen; i++) {
+        if (procs[i].burst_left <= 0) {
+            continue;
+        }
+        procs[i].wait += w.completion[k] - w.burst[k];
+        procs[i].burst_left = 0;
+        total += w.burst[k];
+        k++;
+    }
+    return total;
+}
+
+/**
+ * Exact sum of every PCB's wait, for computing averages without going
+ * through floating point per process.
+ */
+int64_t procs64_sum_wait(const struct pcb64* procs, int plen) {
+    if (!procs || plen <= 0) {
+        return 0;
+    }
+
+    int64_t sum = 0;
+    for (int i = 0; i < plen; i++) {
+        sum += procs[i].wait;
+    }
+    return sum;
+}
+
+/**
+ * Initialize an array of PCBs with arrival times on the heap.
+ *
+ * @param arrivals Arrival time of each process, or NULL for all at time 0.
+ * @return         Pointer to a newly allocated array of struct apcb of length
+ *                 blen, or NULL if blen <= 0, bursts is NULL, or allocation
+ *                 fails.
+ */
+struct apcb* init_aprocs(const int* bursts, const int* arrivals, int blen) {
+    if (blen <= 0 || bursts == NULL) {
+        return NULL;
+    }
+
+    struct apcb* procs = malloc(sizeof(struct apcb) * blen);
+    if (!procs) {
+        return NULL;
+    }
+
+    for (int i = 0; i < blen; i++) {
+        procs[i].pid        = i;
+        procs[i].burst_left = bursts[i];
+        procs[i].wait       = 0;
+        procs[i].arrival    = arrivals ? arrivals[i] : 0;
+    }
+
+    return procs;
+}
+
+/** Event kinds, in the order they are handled when they share a time */
+enum ev_kind {
+    EV_ARRIVAL,   /** A process becomes ready */
+    EV_SLICE_END, /** The running process finished its slice */
+};
+
+/** A scheduled event for the event-driven engine */
+struct ev_event {
+    long long time;    /** When the event happens */
+    enum ev_kind kind; /** What happens */
+    int index;         /** Which process it concerns */
+};
+
+/** 4-ary min-heap of events: shallower than a binary heap, and the four
+ *  children of a node sit next to each other in memory. */
+struct ev_heap {
+    struct ev_event* data;
+    int len;
+};
+
+/** Event order: by time, then kind, then process index (order listed). */
+static int ev_before(const struct ev_event* a, const struct ev_event* b) {
+    if (a->time != b->time) {
+        return a->time < b->time;
+    }
+    if (a->kind != b->kind) {
+        return a->kind < b->kind;
+    }
+    return a->index < b->index;
+}
+
+static void ev_sift_down(struct ev_heap* heap, int i) {
+    struct ev_event item = heap->data[i];
+    while (1) {
+        int first = 4 * i + 1;
+        if (first >= heap->len) {
+            break;
+        }
+        int last = (first + 4 < heap->len) ? first + 4 : heap->len;
+        int best = first;
+        for (int c = first + 1; c < last; c++) {
+            if (ev_before(&heap->data[c], &heap->data[best])) {
+                best = c;
+            }
+        }
+        if (!ev_before(&heap->data[best], &item)) {
+            break;
+        }
+        heap->data[i] = heap->data[best];
+        i = best;
+    }
+    heap->data[i] = item;
+}
+
+static void ev_push(struct ev_heap* heap, struct ev_event event) {
+    int i = heap->len++;
+    while (i > 0) {
+        int parent = (i - 1) / 4;
+        if (!ev_before(&event, &heap->data[parent])) {
+            break;
+        }
+        heap->data[i] = heap->data[parent];
+        i = parent;
+    }
+    heap->data[i] = event;
+}
+
+static struct ev_event ev_pop(struct ev_heap* heap) {
+    struct ev_event top = heap->data[0];
+    heap->data[0] = heap->data[--heap->len];
+    if (heap->len > 0) {
+        ev_sift_down(heap, 0);
+    }
+    return top;
+}
+
+/**
+ * Event-driven simulation core shared by ev_fcfs_run() and ev_rr_run().
+ *
+ * The heap holds every pending arrival plus, while the CPU is busy, the end
+ * of the current slice. Popping the earliest event moves the clock straight
+ * to it, so idle gaps between arrivals cost nothing. Arrivals join the tail
+ * of a FIFO ready queue; a preempted process rejoins it after any process
+ * that arrived at the same instant.
+ *
+ * Waits are settled lazily: a process arriving at a with burst b that
+ * completes at C waited C - a - b. Processes with burst_left <= 0 are left
+ * untouched.
+ *
+ * @param quantum Slice length, or INT_MAX to run each process to completion.
+ * @return        The time at which the last process completes, or -1 if the
+ *                event heap or ready queue cannot be allocated.
+ */
+static int ev_run(struct apcb* procs, int plen, int quantum) {
+    struct ev_heap heap = { malloc(sizeof(struct ev_event) * (plen + 1)), 0 };
+    int* ready = malloc(sizeof(int) * plen);
+    if (!heap.data || !ready) {
+        free(heap.data);
+        free(ready);
+        return -1;
+    }
+
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            procs[i].wait -= procs[i].arrival + procs[i].burst_left;
+            heap.data[heap.len++] = (struct ev_event){ procs[i].arrival, EV_ARRIVAL, i };
+        }
+    }
+    for (int i = heap.len / 4; i >= 0 && heap.len > 0; i--) {
+        ev_sift_down(&heap, i);
+    }
+
+    int head = 0, count = 0; // ready queue ring buffer
+    int running = -1;
+    long long clock = 0;
+
+    while (heap.len > 0) {
+        struct ev_event event = ev_pop(&heap);
+        clock = event.time;
+
+        if (event.kind == EV_ARRIVAL) {
+            ready[(head + count++) % plen] = event.index;
+        } else {
+            running = -1;
+            if (procs[event.index].burst_left == 0) {
+                procs[event.index].wait += (int)clock;
+            } else {
+                ready[(head + count++) % plen] = event.index;
+            }
+        }
+
+        if (running == -1 && count > 0) {
+            running = ready[head];
+            head = (head + 1) % plen;
+            count--;
+
+            int used = procs[running].burst_left;
+            if (used > quantum) {
+                used = quantum;
+            }
+            procs[running].burst_left -= used;
+            ev_push(&heap, (struct ev_event){ clock + used, EV_SLICE_END, running });
+        }
+    }
+
+    free(heap.data);
+    free(ready);
+    return (int)clock;
+}
+
+/**
+ * Run a First-Come-First-Serve (FCFS) schedule on processes with arrival
+ * times, using the event-driven core (see ev_run()). Ties in arrival time are
+ * broken by index; with every arrival at 0 the result matches fcfs_run().
+ *
+ * @return The time at which the last process completes (0 if there are none,
+ *         -1 if memory cannot be allocated).
+ */
+int ev_fcfs_run(struct apcb* procs, int plen) {
+    if (!procs || plen <= 0) {
+        return 0;
+    }
+    return ev_run(procs, plen, INT_MAX);
+}
+
+/**
+ * Run a Round-Robin (RR) schedule on processes with arrival times, using the
+ * event-driven core (see ev_run()). With every arrival at 0 the result
+ * matches rr_run().
+ *
+ * @return The time at which the last process completes (0 if there are none,
+ *         -1 if memory cannot be allocated).
+ */
+int ev_rr_run(struct apcb* procs, int plen, int quantum) {
+    if (!procs || plen <= 0 || quantum <= 0) {
+        return 0;
+    }
+    return ev_run(procs, plen, quantum);
+}
+
+/**
+ * Indexed binary min-heap of process indices, ordered by (key, tie, index).
+ *
+ * 'pos' maps each process to its slot so a queued process's key can be
+ * lowered in place (decrease-key) in O(log n).
+ */
+struct idx_heap {
+    int* heap;      /** Process indices in heap order */
+    int* pos;       /** Slot of each process in 'heap', or -1 if not queued */
+    int* key;       /** Primary key of each process (remaining burst) */
+    const int* tie; /** Secondary key of each process, or NULL */
+    int len;        /** Number of queued processes */
+};
+
+static int idx_heap_init(struct idx_heap* h, int n, const int* tie) {
+    h->heap = malloc(sizeof(int) * n);
+    h->pos = malloc(sizeof(int) * n);
+    h->key = malloc(sizeof(int) * n);
+    h->tie = tie;
+    h->len = 0;
+    if (!h->heap || !h->pos || !h->key) {
+        free(h->heap);
+        free(h->pos);
+        free(h->key);
+        return -1;
+    }
+    for (int i = 0; i < n; i++) {
+        h->pos[i] = -1;
+    }
+    return 0;
+}
+
+static void idx_heap_free(struct idx_heap* h) {
+    free(h->heap);
+    free(h->pos);
+    free(h->key);
+}
+
+static int idx_heap_less(const struct idx_heap* h, int a, int b) {
+    if (h->key[a] != h->key[b]) {
+        return h->key[a] < h->key[b];
+    }
+    if (h->tie && h->tie[a] != h->tie[b]) {
+        return h->tie[a] < h->tie[b];
+    }
+    return a < b;
+}
+
+static void idx_heap_place(struct idx_heap* h, int slot, int item) {
+    h->heap[slot] = item;
+    h->pos[item] = slot;
+}
+
+static void idx_heap_sift_up(struct idx_heap* h, int slot) {
+    int item = h->heap[slot];
+    while (slot > 0) {
+        int parent = (slot - 1) / 2;
+        if (!idx_heap_less(h, item, h->heap[parent])) {
+            break;
+        }
+        idx_heap_place(h, slot, h->heap[parent]);
+        slot = parent;
+    }
+    idx_heap_place(h, slot, item);
+}
+
+static void idx_heap_sift_down(struct idx_heap* h, int slot) {
+    int item = h->heap[slot];
+    while (1) {
+        int child = 2 * slot + 1;
+        if (child >= h->len) {
+            break;
+        }
+        if (child + 1 < h->len && idx_heap_less(h, h->heap[child + 1], h->heap[child])) {
+            child++;
+        }
+        if (!idx_heap_less(h, h->heap[child], item)) {
+            break;
+        }
+        idx_heap_place(h, slot, h->heap[child]);
+        slot = child;
+    }
+    idx_heap_place(h, slot, item);
+}
+
+static void idx_heap_push(struct idx_heap* h, int item, int key) {
+    h->key[item] = key;
+    idx_heap_place(h, h->len++, item);
+    idx_heap_sift_up(h, h->len - 1);
+}
+
+static int idx_heap_pop(struct idx_heap* h) {
+    int top = h->heap[0];
+    h->pos[top] = -1;
+    if (--h->len > 0) {
+        idx_heap_place(h, 0, h->heap[h->len]);
+        idx_heap_sift_down(h, 0);
+    }
+    return top;
+}
+
+/** Lower the key of a queued process and restore the heap order. */
+static void idx_heap_decrease(struct idx_heap* h, int item, int key) {
+    h->key[item] = key;
+    idx_heap_sift_up(h, h->pos[item]);
+}
+
+/**
+ * Run a Shortest-Job-First (SJF) schedule on the given processes.
+ *
+ * All processes arrive at time 0; the one with the shortest burst runs to
+ * completion next, ties going to the lower index. Unfinished processes are
+ * kept in an indexed min-heap, so the schedule costs O(n log n).
+ *
+ * This function mutates the 'procs' array (burst_left and wait) and returns
+ * the total time elapsed when all processes are done, like fcfs_run().
+ * Returns -1 if the heap cannot be allocated.
+ */
+int sjf_run(struct pcb* procs, int plen) {
+    if (!procs || plen <= 0) {
+        return 0;
+    }
+
+    struct idx_heap h;
+    if (idx_heap_init(&h, plen, NULL) != 0) {
+        return -1;
+    }
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            idx_heap_push(&h, i, procs[i].burst_left);
+        }
+    }
+
+    int time = 0;
+    while (h.len > 0) {
+        int i = idx_heap_pop(&h);
+        procs[i].wait += time;
+        time += procs[i].burst_left;
+        procs[i].burst_left = 0;
+    }
+
+    idx_heap_free(&h);
+    return time;
+}
+
+/** (arrival, index) key used by srtf_run() to admit processes in order */
+struct arrival_key {
+    int arrival; /** Arrival time of the process */
+    int index;   /** Position in the PCB array */
+};
+
+/** Order by arrival time, then by index. */
+static int arrival_key_cmp(const void* a, const void* b) {
+    const struct arrival_key* x = a;
+    const struct arrival_key* y = b;
+    if (x->arrival != y->arrival) {
+        return (x->arrival > y->arrival) - (x->arrival < y->arrival);
+    }
+    return (x->index > y->index) - (x->index < y->index);
+}
+
+/**
+ * Run a preemptive Shortest-Remaining-Time-First (SRTF) schedule on
+ * processes with arrival times.
+ *
+ * Ready processes sit in an indexed min-heap keyed by remaining burst (ties:
+ * earlier arrival, then lower index), and the running process is its top.
+ * The clock jumps to whichever comes first, the next arrival or the running
+ * process's completion. At an arrival the running process's remaining time
+ * is lowered in place (decrease-key) and the newcomers are pushed; if one of
+ * them is now on top, it preempts. Total cost is O(n log n).
+ *
+ * Waits are settled at completion as C - arrival - burst. Processes with
+ * burst_left <= 0 are left untouched. Returns the time at which the last
+ * process completes, or -1 if memory cannot be allocated.
+ */
+int srtf_run(struct apcb* procs, int plen) {
+    if (!procs || plen <= 0) {
+        return 0;
+    }
+
+    struct arrival_key* order = malloc(sizeof(struct arrival_key) * plen);
+    int* arrival = malloc(sizeof(int) * plen);
+    if (!order || !arrival) {
+        free(order);
+        free(arrival);
+        return -1;
+    }
+    for (int i = 0; i < plen; i++) {
+        arrival[i] = procs[i].arrival;
+    }
+
+    struct idx_heap h;
+    if (idx_heap_init(&h, plen, arrival) != 0) {
+        free(order);
+        free(arrival);
+        return -1;
+    }
+
+    int n = 0;
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            order[n++] = (struct arrival_key){ procs[i].arrival, i };
+            procs[i].wait -= procs[i].arrival + procs[i].burst_left;
+        }
+    }
+    qsort(order, n, sizeof(struct arrival_key), arrival_key_cmp);
+
+    long long clock = 0;
+    int next = 0;
+    while (next < n || h.len > 0) {
+        if (h.len == 0 && clock < order[next].arrival) {
+            clock = order[next].arrival; // idle until the next arrival
+        }
+        while (next < n && order[next].arrival <= clock) {
+            int i = order[next++].index;
+            idx_heap_push(&h, i, procs[i].burst_left);
+        }
+
+        int top = h.heap[0];
+        long long finish = clock + h.key[top];
+        if (next < n && order[next].arrival < finish) {
+            int ran = (int)(order[next].arrival - clock);
+            clock = order[next].arrival;
+            idx_heap_decrease(&h, top, h.key[top] - ran);
+        } else {
+            clock = finish;
+            idx_heap_pop(&h);
+            procs[top].burst_left = 0;
+            procs[top].wait += (int)clock;
+        }
+    }
+
+    idx_heap_free(&h);
+    free(order);
+    free(arrival);
+    return (int)clock;
+}
+
+/**
+ * Run a Multi-Level Feedback Queue (MLFQ) schedule on the given processes.
+ *
+ * There are 'nlevels' ready queues, level 0 having the highest priority, and
+ * a process at level k runs for up to quanta[k] time units. A process that
+ * uses its whole slice without finishing is demoted one level; the lowest
+ * level is plain Round-Robin. All processes start at level 0, in index order.
+ *
+ * Each level is a FIFO threaded through a 'next' array indexed like the PCBs,
+ * and the non-empty levels are bits in a 64-bit word, so picking the highest
+ * non-empty level (count trailing zeros), dispatching and demoting are all
+ * O(1). Slices are accounted like rr_run() (see lazy_begin()).
+ *
+ * With nlevels == 1 this is exactly rr_run(procs, plen, quanta[0]).
+ *
+ * @param nlevels Number of levels, 1..MLFQ_MAX_LEVELS.
+ * @param quanta  Slice length of each level; all must be > 0.
+ * @return        The total time elapsed when all processes are finished, 0 if
+ *                the arguments are invalid, or -1 if memory cannot be allocated.
+ */
+int mlfq_run(struct pcb* procs, int plen, int nlevels, const int* quanta) {
+    if (!procs || plen <= 0 || !quanta || nlevels <= 0 || nlevels > MLFQ_MAX_LEVELS) {
+        return 0;
+    }
+    for (int k = 0; k < nlevels; k++) {
+        if (quanta[k] <= 0) {
+            return 0;
+        }
+    }
+
+    int* next = malloc(sizeof(int) * plen);
+    if (!next) {
+        return -1;
+    }
+
+    int head[MLFQ_MAX_LEVELS];
+    int tail[MLFQ_MAX_LEVELS];
+    uint64_t nonempty = 0;
+
+    // Everyone unfinished starts at level 0, in index order.
+    head[0] = tail[0] = -1;
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left <= 0) {
+            continue;
+        }
+        next[i] = -1;
+        if (tail[0] == -1) {
+            head[0] = i;
+        } else {
+            next[tail[0]] = i;
+        }
+        tail[0] = i;
+        nonempty = 1;
+    }
+
+    lazy_begin(procs, plen);
+
+    int time = 0;
+    while (nonempty) {
+        int level = __builtin_ctzll(nonempty);
+        int current = head[level];
+        head[level] = next[current];
+        if (head[level] == -1) {
+            nonempty &= ~(UINT64_C(1) << level);
+        }
+
+        time += lazy_run_proc(procs, current, quanta[level], time);
+        if (procs[current].burst_left <= 0) {
+            continue;
+        }
+
+        int lower = (level + 1 < nlevels) ? level + 1 : level;
+        next[current] = -1;
+        if (nonempty & (UINT64_C(1) << lower)) {
+            next[tail[lower]] = current;
+        } else {
+            head[lower] = current;
+            nonempty |= UINT64_C(1) << lower;
+        }
+        tail[lower] = current;
+    }
+
+    free(next);
+    return time;
+}
+
+/**
+ * Red-black tree of runnable processes for cfs_run(), keyed by
+ * (vruntime, index). Nodes are process indices; the links live in arrays
+ * indexed like the PCBs, with index 'nil' as the shared black sentinel.
+ */
+struct cfs_tree {
+    int* left;          /** Left child of each node */
+    int* right;         /** Right child of each node */
+    int* parent;        /** Parent of each node */
+    unsigned char* red; /** 1 if the node is red */
+    uint64_t* vruntime; /** Virtual runtime of each process */
+    int root;           /** Root node, or nil */
+    int nil;            /** Sentinel node */
+};
+
+static int cfs_tree_init(struct cfs_tree* t, int n) {
+    t->left = malloc(sizeof(int) * (n + 1));
+    t->right = malloc(sizeof(int) * (n + 1));
+    t->parent = malloc(sizeof(int) * (n + 1));
+    t->red = calloc(n + 1, 1);
+    t->vruntime = calloc(n + 1, sizeof(uint64_t));
+    t->nil = n;
+    t->root = n;
+    if (!t->left || !t->right || !t->parent || !t->red || !t->vruntime) {
+        free(t->left);
+        free(t->right);
+        free(t->parent);
+        free(t->red);
+        free(t->vruntime);
+        return -1;
+    }
+    t->left[n] = t->right[n] = t->parent[n] = n;
+    return 0;
+}
+
+static void cfs_tree_free(struct cfs_tree* t) {
+    free(t->left);
+    free(t->right);
+    free(t->parent);
+    free(t->red);
+    free(t->vruntime);
+}
+
+static int cfs_less(const struct cfs_tree* t, int a, int b) {
+    if (t->vruntime[a] != t->vruntime[b]) {
+        return t->vruntime[a] < t->vruntime[b];
+    }
+    return a < b;
+}
+
+static void cfs_rotate_left(struct cfs_tree* t, int x) {
+    int y = t->right[x];
+    t->right[x] = t->left[y];
+    if (t->left[y] != t->nil) {
+        t->parent[t->left[y]] = x;
+    }
+    t->parent[y] = t->parent[x];
+    if (t->parent[x] == t->nil) {
+        t->root = y;
+    } else if (x == t->left[t->parent[x]]) {
+        t->left[t->parent[x]] = y;
+    } else {
+        t->right[t->parent[x]] = y;
+    }
+    t->left[y] = x;
+    t->parent[x] = y;
+}
+
+static void cfs_rotate_right(struct cfs_tree* t, int x) {
+    int y = t->left[x];
+    t->left[x] = t->right[y];
+    if (t->right[y] != t->nil) {
+        t->parent[t->right[y]] = x;
+    }
+    t->parent[y] = t->parent[x];
+    if (t->parent[x] == t->nil) {
+        t->root = y;
+    } else if (x == t->right[t->parent[x]]) {
+        t->right[t->parent[x]] = y;
+    } else {
+        t->left[t->parent[x]] = y;
+    }
+    t->right[y] = x;
+    t->parent[x] = y;
+}
+
+static void cfs_tree_insert(struct cfs_tree* t, int z) {
+    int y = t->nil;
+    int x = t->root;
+    while (x != t->nil) {
+        y = x;
+        x = cfs_less(t, z, x) ? t->left[x] : t->right[x];
+    }
+    t->parent[z] = y;
+    if (y == t->nil) {
+        t->root = z;
+    } else if (cfs_less(t, z, y)) {
+        t->left[y] = z;
+    } else {
+        t->right[y] = z;
+    }
+    t->left[z] = t->right[z] = t->nil;
+    t->red[z] = 1;
+
+    while (t->red[t->parent[z]]) {
+        int p = t->parent[z];
+        int g = t->parent[p];
+        if (p == t->left[g]) {
+            int uncle = t->right[g];
+            if (t->red[uncle]) {
+                t->red[p] = t->red[uncle] = 0;
+                t->red[g] = 1;
+                z = g;
+                continue;
+            }
+            if (z == t->right[p]) {
+                z = p;
+                cfs_rotate_left(t, z);
+                p = t->parent[z];
+            }
+            t->red[p] = 0;
+            t->red[g] = 1;
+            cfs_rotate_right(t, g);
+        } else {
+            int uncle = t->left[g];
+            if (t->red[uncle]) {
+                t->red[p] = t->red[uncle] = 0;
+                t->red[g] = 1;
+                z = g;
+                continue;
+            }
+            if (z == t->left[p]) {
+                z = p;
+                cfs_rotate_right(t, z);
+                p = t->parent[z];
+            }
+            t->red[p] = 0;
+            t->red[g] = 1;
+            cfs_rotate_left(t, g);
+        }
+    }
+    t->red[t->root] = 0;
+}
+
+/** Replace the subtree rooted at u with the one rooted at v. */
+static void cfs_transplant(struct cfs_tree* t, int u, int v) {
+    if (t->parent[u] == t->nil) {
+        t->root = v;
+    } else if (u == t->left[t->parent[u]]) {
+        t->left[t->parent[u]] = v;
+    } else {
+        t->right[t->parent[u]] = v;
+    }
+    t->parent[v] = t->parent[u];
+}
+
+static int cfs_tree_min(const struct cfs_tree* t, int x) {
+    while (t->left[x] != t->nil) {
+        x = t->left[x];
+    }
+    return x;
+}
+
+static void cfs_tree_remove(struct cfs_tree* t, int z) {
+    int y = z;
+    int y_was_red = t->red[y];
+    int x;
+    if (t->left[z] == t->nil) {
+        x = t->right[z];
+        cfs_transplant(t, z, t->right[z]);
+    } else if (t->right[z] == t->nil) {
+        x = t->left[z];
+        cfs_transplant(t, z, t->left[z]);
+    } else {
+        y = cfs_tree_min(t, t->right[z]);
+        y_was_red = t->red[y];
+        x = t->right[y];
+        if (t->parent[y] == z) {
+            t->parent[x] = y;
+        } else {
+            cfs_transplant(t, y, t->right[y]);
+            t->right[y] = t->right[z];
+            t->parent[t->right[y]] = y;
+        }
+        cfs_transplant(t, z, y);
+        t->left[y] = t->left[z];
+        t->parent[t->left[y]] = y;
+        t->red[y] = t->red[z];
+    }
+    if (y_was_red) {
+        return;
+    }
+
+    while (x != t->root && !t->red[x]) {
+        int p = t->parent[x];
+        if (x == t->left[p]) {
+            int w = t->right[p];
+            if (t->red[w]) {
+                t->red[w] = 0;
+                t->red[p] = 1;
+                cfs_rotate_left(t, p);
+                w = t->right[p];
+            }
+            if (!t->red[t->left[w]] && !t->red[t->right[w]]) {
+                t->red[w] = 1;
+                x = p;
+                continue;
+            }
+            if (!t->red[t->right[w]]) {
+                t->red[t->left[w]] = 0;
+                t->red[w] = 1;
+                cfs_rotate_right(t, w);
+                w = t->right[p];
+            }
+            t->red[w] = t->red[p];
+            t->red[p] = 0;
+            t->red[t->right[w]] = 0;
+            cfs_rotate_left(t, p);
+        } else {
+            int w = t->left[p];
+            if (t->red[w]) {
+                t->red[w] = 0;
+                t->red[p] = 1;
+                cfs_rotate_right(t, p);
+                w = t->left[p];
+            }
+            if (!t->red[t->right[w]] && !t->red[t->left[w]]) {
+                t->red[w] = 1;
+                x = p;
+                continue;
+            }
+            if (!t->red[t->left[w]]) {
+                t->red[t->right[w]] = 0;
+                t->red[w] = 1;
+                cfs_rotate_left(t, w);
+                w = t->left[p];
+            }
+            t->red[w] = t->red[p];
+            t->red[p] = 0;
+            t->red[t->left[w]] = 0;
+            cfs_rotate_right(t, p);
+        }
+        x = t->root;
+    }
+    t->red[x] = 0;
+}
+
+/**
+ * Run a Completely-Fair (CFS-style) schedule on the given processes.
+ *
+ * Each runnable process has a virtual runtime that grows by the time it runs
+ * scaled by CFS_NICE0_WEIGHT / weight, so heavier processes accumulate it
+ * more slowly and get a larger share of the CPU. The process with the lowest
+ * virtual runtime (ties: lowest index) runs next, for up to min_granularity
+ * time units. Runnable processes are kept in a red-black tree keyed by
+ * virtual runtime with the leftmost node cached, so a dispatch is O(1) to
+ * pick plus O(log n) to requeue.
+ *
+ * Waits are accounted like rr_run() (see lazy_begin()). With equal weights
+ * this is exactly rr_run(procs, plen, min_granularity).
+ *
+ * @param weights         Weight of each process (> 0), or NULL for
+ *                        CFS_NICE0_WEIGHT each.
+ * @param min_granularity Longest slice a process runs before the next pick.
+ * @return                The total time elapsed when all processes are
+ *                        finished, 0 if the arguments are invalid, or -1 if
+ *                        memory cannot be allocated.
+ */
+int cfs_run(struct pcb* procs, int plen, const int* weights, int min_granularity) {
+    if (!procs || plen <= 0 || min_granularity <= 0) {
+        return 0;
+    }
+    for (int i = 0; weights && i < plen; i++) {
+        if (weights[i] <= 0) {
+            return 0;
+        }
+    }
+
+    struct cfs_tree t;
+    if (cfs_tree_init(&t, plen) != 0) {
+        return -1;
+    }
+
+    int leftmost = t.nil;
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            cfs_tree_insert(&t, i);
+            if (leftmost == t.nil) {
+                leftmost = i;
+            }
+        }
+    }
+
+    lazy_begin(procs, plen);
+
+    int time = 0;
+    while (leftmost != t.nil) {
+        int current = leftmost;
+        // In-order successor of the leftmost node, which has no left child.
+        if (t.right[current] != t.nil) {
+            leftmost = cfs_tree_min(&t, t.right[current]);
+        } else {
+            leftmost = t.parent[current];
+        }
+        cfs_tree_remove(&t, current);
+
+        int used = lazy_run_proc(procs, current, min_granularity, time);
+        time += used;
+        if (procs[current].burst_left <= 0) {
+            continue;
+        }
+
+        // Fixed point (2^10 per time unit) keeps heavy weights from rounding to 0.
+        int weight = weights ? weights[current] : CFS_NICE0_WEIGHT;
+        t.vruntime[current] += ((uint64_t)used * CFS_NICE0_WEIGHT << 10) / weight;
+        cfs_tree_insert(&t, current);
+        if (leftmost == t.nil || cfs_less(&t, current, leftmost)) {
+            leftmost = current;
+        }
+    }
+
+    cfs_tree_free(&t);
+    return time;
+}
+
+/**
+ * Fast seedable pseudo-random generator (SplitMix64) used by lottery_run().
+ * The same starting state always yields the same sequence.
+ */
+uint64_t sched_rand_next(uint64_t* state) {
+    uint64_t z = (*state += UINT64_C(0x9E3779B97F4A7C15));
+    z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return z ^ (z >> 31);
+}
+
+/**
+ * Draw a number uniformly from [0, bound) with sched_rand_next().
+ *
+ * The draw is the high word of the 64x64-bit product of a random word and
+ * 'bound', which has no modulo bias from small bounds. The product is built
+ * from 32-bit halves so it needs no 128-bit integer type.
+ */
+uint64_t sched_rand_below(uint64_t* state, uint64_t bound) {
+    uint64_t r = sched_rand_next(state);
+    uint64_t r_lo = (uint32_t)r, r_hi = r >> 32;
+    uint64_t b_lo = (uint32_t)bound, b_hi = bound >> 32;
+
+    uint64_t lo_lo = r_lo * b_lo;
+    uint64_t hi_lo = r_hi * b_lo;
+    uint64_t lo_hi = r_lo * b_hi;
+    uint64_t cross = (lo_lo >> 32) + (uint32_t)hi_lo + lo_hi; // cannot overflow
+    return r_hi * b_hi + (hi_lo >> 32) + (cross >> 32);
+}
+
+/** Check a per-process ticket array: NULL, or every entry > 0. */
+static int tickets_valid(const int* tickets, int plen) {
+    for (int i = 0; tickets && i < plen; i++) {
+        if (tickets[i] <= 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Run a lottery schedule on the given processes.
+ *
+ * Before every slice a ticket is drawn uniformly from those held by the
+ * unfinished processes, and its holder runs for up to 'quantum' time units.
+ * Ticket counts live in a Fenwick tree indexed like the PCBs: the winner is
+ * found by descending the tree and a finished process's tickets are removed,
+ * both in O(log n).
+ *
+ * Waits are accounted like rr_run() (see lazy_begin()).
+ *
+ * @param tickets Tickets of each process (> 0), or NULL for one each.
+ * @param seed    Starting state for sched_rand_below(); equal seeds give
+ *                identical schedules.
+ * @return        The total time elapsed when all processes are finished, 0 if
+ *                the arguments are invalid, or -1 if memory cannot be allocated.
+ */
+int lottery_run(struct pcb* procs, int plen, const int* tickets, int quantum, uint64_t seed) {
+    if (!procs || plen <= 0 || quantum <= 0 || !tickets_valid(tickets, plen)) {
+        return 0;
+    }
+
+    int64_t* fenwick = calloc(plen + 1, sizeof(int64_t));
+    if (!fenwick) {
+        return -1;
+    }
+
+    uint64_t total = 0;
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            fenwick[i + 1] = tickets ? tickets[i] : 1;
+            total += fenwick[i + 1];
+        }
+    }
+    for (int x = 1; x <= plen; x++) { // O(n) build
+        int up = x + (x & -x);
+        if (up <= plen) {
+            fenwick[up] += fenwick[x];
+        }
+    }
+    int top = 1;
+    while (top * 2 <= plen) {
+        top *= 2;
+    }
+
+    lazy_begin(procs, plen);
+
+    int time = 0;
+    while (total > 0) {
+        uint64_t draw = sched_rand_below(&seed, total); // ticket number
+
+        // Smallest index whose ticket prefix sum exceeds 'draw'.
+        int pos = 0;
+        for (int step = top; step > 0; step /= 2) {
+            if (pos + step <= plen && (uint64_t)fenwick[pos + step] <= draw) {
+                pos += step;
+                draw -= fenwick[pos];
+            }
+        }
+        int winner = pos;
+
+        time += lazy_run_proc(procs, winner, quantum, time);
+        if (procs[winner].burst_left <= 0) {
+            int held = tickets ? tickets[winner] : 1;
+            for (int x = winner + 1; x <= plen; x += x & -x) {
+                fenwick[x] -= held;
+            }
+            total -= held;
+        }
+    }
+
+    free(fenwick);
+    return time;
+}
+
+/**
+ * Run a stride schedule on the given processes.
+ *
+ * Each process has a stride of STRIDE1 / tickets and a pass value starting
+ * at 0. The process with the lowest pass (ties: lowest index) runs for up to
+ * 'quantum' time units and then advances its pass by its stride, so CPU time
+ * is shared in proportion to tickets, deterministically. Passes sit in a
+ * segment tree whose nodes hold the index of their subtree's minimum: the
+ * winner is the root, and an update is O(log n).
+ *
+ * Waits are accounted like rr_run() (see lazy_begin()). With equal tickets
+ * this is exactly rr_run(procs, plen, quantum).
+ *
+ * @param tickets Tickets of each process (> 0), or NULL for one each.
+ * @return        The total time elapsed when all processes are finished, 0 if
+ *                the arguments are invalid, or -1 if memory cannot be allocated.
+ */
+int stride_run(struct pcb* procs, int plen, const int* tickets, int quantum) {
+    if (!procs || plen <= 0 || quantum <= 0 || !tickets_valid(tickets, plen)) {
+        return 0;
+    }
+
+    int size = 1;
+    while (size < plen) {
+        size *= 2;
+    }
+    uint64_t* pass = malloc(sizeof(uint64_t) * size);
+    int* tree = malloc(sizeof(int) * 2 * size);
+    if (!pass || !tree) {
+        free(pass);
+        free(tree);
+        return -1;
+    }
+
+    // Finished processes and padding leaves never win.
+    for (int i = 0; i < size; i++) {
+        pass[i] = (i < plen && procs[i].burst_left > 0) ? 0 : UINT64_MAX;
+        tree[size + i] = i;
+    }
+    for (int node = size - 1; node >= 1; node--) {
+        int a = tree[2 * node], b = tree[2 * node + 1];
+        tree[node] = (pass[b] < pass[a]) ? b : a;
+    }
+
+    lazy_begin(procs, plen);
+
+    int time = 0;
+    while (pass[tree[1]] != UINT64_MAX) {
+        int current = tree[1];
+        time += lazy_run_proc(procs, current, quantum, time);
+        if (procs[current].burst_left <= 0) {
+            pass[current] = UINT64_MAX;
+        } else {
+            pass[current] += STRIDE1 / (tickets ? tickets[current] : 1);
+        }
+
+        for (int node = (size + current) / 2; node >= 1; node /= 2) {
+            int a = tree[2 * node], b = tree[2 * node + 1];
+            tree[node] = (pass[b] < pass[a]) ? b : a;
+        }
+    }
+
+    free(pass);
+    free(tree);
+    return time;
+}
+
+/**
+ * Run a Deficit Round-Robin (DRR) schedule with a quantum per process.
+ *
+ * Unfinished processes sit in an active ring in index order. The process at
+ * the front is credited quanta[i] time units, runs for up to that credit,
+ * and goes to the back of the ring unless it finished. Because CPU time is
+ * divisible, a process only leaves credit unused when it finishes (which
+ * forfeits it), so no deficit carries over between rounds and each visit is
+ * simply a slice of quanta[i]. Dispatch is O(1): a pop and a push on the ring
+ * instead of an rr_next() scan.
+ *
+ * Waits are accounted like rr_run() (see lazy_begin()). With every quantum
+ * equal to q this is exactly rr_run(procs, plen, q).
+ *
+ * @param quanta Quantum of each process; all must be > 0.
+ * @return       The total time elapsed when all processes are finished, 0 if
+ *               the arguments are invalid, or -1 if memory cannot be allocated.
+ */
+int drr_run(struct pcb* procs, int plen, const int* quanta) {
+    if (!procs || plen <= 0 || !quanta) {
+        return 0;
+    }
+    for (int i = 0; i < plen; i++) {
+        if (quanta[i] <= 0) {
+            return 0;
+        }
+    }
+
+    int* ring = malloc(sizeof(int) * plen);
+    if (!ring) {
+        return -1;
+    }
+
+    int head = 0, count = 0;
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            ring[count++] = i;
+        }
+    }
+
+    lazy_begin(procs, plen);
+
+    int time = 0;
+    while (count > 0) {
+        int current = ring[head];
+        head = (head + 1) % plen;
+        count--;
+
+        time += lazy_run_proc(procs, current, quanta[current], time);
+        if (procs[current].burst_left > 0) {
+            ring[(head + count++) % plen] = current;
+        }
+    }
+
+    free(ring);
+    return time;
+}
+
+/**
+ * Run FCFS on many independent workloads stored back to back.
+ *
+ * Workload w is bursts[offsets[w]] .. bursts[offsets[w + 1] - 1] (offsets
+ * has nwork + 1 entries, CSR style). The wait of each process, as fcfs_run()
+ * would leave it starting from 0, goes to the same index of 'waits', and the
+ * workload's total time to totals[w]. Nothing is allocated.
+ *
+ * On AVX2 CPUs eight workloads are processed at once, one per vector lane:
+ * step k gathers the k-th burst of every lane and advances eight running
+ * prefix sums together.
+ */
+static void fcfs_batch_scalar(const int* bursts, const int* offsets, int nwork,
+                              int* waits, int* totals) {
+    for (int w = 0; w < nwork; w++) {
+        int time = 0;
+        for (int i = offsets[w]; i < offsets[w + 1]; i++) {
+            waits[i] = (bursts[i] > 0) ? time : 0;
+            time += (bursts[i] > 0) ? bursts[i] : 0;
+        }
+        totals[w] = time;
+    }
+}
+
+#ifdef PARTA_X86
+__attribute__((target("avx2")))
+static void fcfs_batch_avx2(const int* bursts, const int* offsets, int nwork,
+                            int* waits, int* totals) {
+    const __m256i zero = _mm256_setzero_si256();
+    int w = 0;
+    for (; w + 8 <= nwork; w += 8) {
+        __m256i start = _mm256_loadu_si256((const __m256i*)(offsets + w));
+        __m256i len = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i*)(offsets + w + 1)), start);
+        int lens[8];
+        _mm256_storeu_si256((__m256i*)lens, len);
+        int maxlen = 0;
+        for (int l = 0; l < 8; l++) {
+            maxlen = (lens[l] > maxlen) ? lens[l] : maxlen;
+        }
+
+        __m256i time = zero;
+        for (int k = 0; k < maxlen; k++) {
+            __m256i step = _mm256_set1_epi32(k);
+            __m256i live = _mm256_cmpgt_epi32(len, step);
+            __m256i index = _mm256_add_epi32(start, step);
+            __m256i b = _mm256_mask_i32gather_epi32(zero, bursts, index, live, 4);
+            __m256i runs = _mm256_cmpgt_epi32(b, zero);
+
+            int wait[8], at[8];
+            _mm256_storeu_si256((__m256i*)wait, _mm256_and_si256(time, runs));
+            _mm256_storeu_si256((__m256i*)at, index);
+            for (int l = 0; l < 8; l++) {
+                if (k < lens[l]) {
+                    waits[at[l]] = wait[l];
+                }
+            }
+            time = _mm256_add_epi32(time, _mm256_and_si256(b, runs));
+        }
+        _mm256_storeu_si256((__m256i*)(totals + w), time);
+    }
+    fcfs_batch_scalar(bursts, offsets + w, nwork - w, waits, totals + w);
+}
+#endif
+
+void fcfs_batch(const int* bursts, const int* offsets, int nwork, int* waits, int* totals) {
+    if (!bursts || !offsets || nwork <= 0 || !waits || !totals) {
+        return;
+    }
+#ifdef PARTA_X86
+    if (cpu_has_avx2()) {
+        fcfs_batch_avx2(bursts, offsets, nwork, waits, totals);
+        return;
+    }
+#endif
+    fcfs_batch_scalar(bursts, offsets, nwork, waits, totals);
+}
+
+/** Sum of min(b, cap) over the entries b > 0 of burst[0, n). */
+static int capped_sum(const int* burst, int n, int cap) {
+    int sum = 0;
+    for (int j = 0; j < n; j++) {
+        if (burst[j] > 0) {
+            sum += (burst[j] < cap) ? burst[j] : cap;
+        }
+    }
+    return sum;
+}
+
+/**
+ * Run Round-Robin on many independent workloads stored back to back, with
+ * the same layout and outputs as fcfs_batch(). Nothing is allocated.
+ *
+ * Each completion time comes straight from the closed form used by
+ * rr_completions(), C_i = b_i + sum_{j < i} min(b_j, r q)
+ * + sum_{j > i} min(b_j, (r - 1) q), evaluated directly in O(n^2) per
+ * workload; that beats sorting for the handful of processes this is meant
+ * for.
+ *
+ * On AVX2 CPUs eight workloads are processed at once, one per vector lane,
+ * as in fcfs_batch(): for the i-th process of every lane, the k-th bursts of
+ * all eight lanes are gathered and their capped sums advanced together.
+ */
+static void rr_batch_scalar(const int* bursts, const int* offsets, int nwork, int quantum,
+                            int* waits, int* totals) {
+    for (int w = 0; w < nwork; w++) {
+        const int* b = bursts + offsets[w];
+        int n = offsets[w + 1] - offsets[w];
+        for (int i = 0; i < n; i++) {
+            if (b[i] <= 0) {
+                waits[offsets[w] + i] = 0;
+                continue;
+            }
+            long long rounds = b[i] / quantum + (b[i] % quantum != 0);
+            long long through = rounds * quantum; // cap for j < i
+            int cap = (through < INT_MAX) ? (int)through : INT_MAX;
+            waits[offsets[w] + i] = capped_sum(b, i, cap)
+                                  + capped_sum(b + i + 1, n - i - 1, (int)(through - quantum));
+        }
+        totals[w] = capped_sum(b, n, INT_MAX);
+    }
+}
+
+#ifdef PARTA_X86
+__attribute__((target("avx2")))
+static void rr_batch_avx2(const int* bursts, const int* offsets, int nwork, int quantum,
+                          int* waits, int* totals) {
+    const __m256i zero = _mm256_setzero_si256();
+    int w = 0;
+    for (; w + 8 <= nwork; w += 8) {
+        __m256i start = _mm256_loadu_si256((const __m256i*)(offsets + w));
+        __m256i len = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i*)(offsets + w + 1)), start);
+        int lens[8];
+        _mm256_storeu_si256((__m256i*)lens, len);
+        int maxlen = 0;
+        for (int l = 0; l < 8; l++) {
+            maxlen = (lens[l] > maxlen) ? lens[l] : maxlen;
+        }
+
+        __m256i total = zero;
+        for (int i = 0; i < maxlen; i++) {
+            __m256i step = _mm256_set1_epi32(i);
+            __m256i index = _mm256_add_epi32(start, step);
+            __m256i bi = _mm256_mask_i32gather_epi32(zero, bursts, index, _mm256_cmpgt_epi32(len, step), 4);
+            total = _mm256_add_epi32(total, _mm256_max_epi32(bi, zero));
+
+            // Caps of each lane's i-th process; 0 for a finished or absent
+            // one, which makes its wait 0.
+            int b[8], before[8], after[8], at[8];
+            _mm256_storeu_si256((__m256i*)b, bi);
+            _mm256_storeu_si256((__m256i*)at, index);
+            for (int l = 0; l < 8; l++) {
+                long long through = (b[l] > 0) ? ((long long)b[l] + quantum - 1) / quantum * quantum : 0;
+                before[l] = (through < INT_MAX) ? (int)through : INT_MAX;
+                after[l] = (b[l] > 0) ? (int)(through - quantum) : 0;
+            }
+            __m256i cap_before = _mm256_loadu_si256((const __m256i*)before);
+            __m256i cap_after = _mm256_loadu_si256((const __m256i*)after);
+
+            __m256i wait = zero;
+            for (int k = 0; k < maxlen; k++) {
+                if (k == i) {
+                    continue;
+                }
+                __m256i other = _mm256_set1_epi32(k);
+                __m256i bk = _mm256_mask_i32gather_epi32(zero, bursts, _mm256_add_epi32(start, other),
+                                                         _mm256_cmpgt_epi32(len, other), 4);
+                __m256i cap = (k < i) ? cap_before : cap_after;
+                wait = _mm256_add_epi32(wait, _mm256_min_epi32(_mm256_max_epi32(bk, zero), cap));
+            }
+
+            int lane_wait[8];
+            _mm256_storeu_si256((__m256i*)lane_wait, wait);
+            for (int l = 0; l < 8; l++) {
+                if (i < lens[l]) {
+                    waits[at[l]] = lane_wait[l];
+                }
+            }
+        }
+        _mm256_storeu_si256((__m256i*)(totals + w), total);
+    }
+    rr_batch_scalar(bursts, offsets + w, nwork - w, quantum, waits, totals + w);
+}
+#endif
+
+void rr_batch(const int* bursts, const int* offsets, int nwork, int quantum,
+              int* waits, int* totals) {
+    if (!bursts || !offsets || nwork <= 0 || quantum <= 0 || !waits || !totals) {
+        return;
+    }
+#ifdef PARTA_X86
+    if (cpu_has_avx2()) {
+        rr_batch_avx2(bursts, offsets, nwork, quantum, waits, totals);
+        return;
+    }
+#endif
+    rr_batch_scalar(bursts, offsets, nwork, quantum, waits, totals);
+}
+
+/**
+ * Set up an arena of 'capacity' bytes for bulk PCB arrays. Arrays are carved
+ * from it with pcb_arena_alloc() and released all at once by
+ * pcb_arena_reset(), so a warmed-up arena serves repeated runs without
+ * touching the allocator.
+ *
+ * @return 0 on success, or -1 if the arena cannot be allocated.
+ */
+int pcb_arena_init(struct pcb_arena* arena, size_t capacity) {
+    if (!arena) {
+        return -1;
+    }
+
+    arena->base = malloc(capacity ? capacity : 1);
+    arena->capacity = arena->base ? capacity : 0;
+    arena->used = 0;
+    return arena->base ? 0 : -1;
+}
+
+/**
+ * Carve 'size' bytes from the arena, aligned for any PCB type.
+ *
+ * @return The block, or NULL if the arena does not have room for it.
+ */
+void* pcb_arena_alloc(struct pcb_arena* arena, size_t size) {
+    if (!arena || !arena->base) {
+        return NULL;
+    }
+
+    size_t align = _Alignof(max_align_t);
+    size_t start = (arena->used + align - 1) & ~(align - 1);
+    if (start > arena->capacity || size > arena->capacity - start) {
+        return NULL;
+    }
+
+    arena->used = start + size;
+    return arena->base + start;
+}
+
+/** Release every block of the arena at once; the memory is kept. */
+void pcb_arena_reset(struct pcb_arena* arena) {
+    if (arena) {
+        arena->used = 0;
+    }
+}
+
+/** Free the arena's memory */
+void pcb_arena_free(struct pcb_arena* arena) {
+    if (!arena) {
+        return;
+    }
+
+    free(arena->base);
+    arena->base = NULL;
+    arena->capacity = 0;
+    arena->used = 0;
+}
+
+/**
+ * Set up an empty Gantt trace. With a NULL 'stream' every segment is kept in
+ * a buffer that grows geometrically; otherwise at most
+ * GANTT_STREAM_SEGMENTS are buffered and full buffers are appended to
+ * 'stream' as raw struct gantt_segment records, after a header of
+ * GANTT_MAGIC, a uint32 version (1) and a uint32 record size, all
+ * little-endian.
+ *
+ * @return 0 on success, or -1 if the buffer cannot be allocated, the header
+ *         cannot be written, or 'stream' is given on a big-endian host.
+ */
+int gantt_trace_init(struct gantt_trace* trace, FILE* stream) {
+    trace->len = 0;
+    trace->cap = stream ? GANTT_STREAM_SEGMENTS : 64;
+    trace->stream = stream;
+    trace->count = 0;
+    trace->segments = malloc(sizeof(struct gantt_segment) * trace->cap);
+    trace->status = (trace->segments && (!stream || PARTA_LITTLE_ENDIAN)) ? 0 : -1;
+
+    if (trace->status == 0 && stream) {
+        uint32_t header[2] = { 1, sizeof(struct gantt_segment) };
+        if (fwrite(GANTT_MAGIC, 8, 1, stream) != 1 || fwrite(header, sizeof(header), 1, stream) != 1) {
+            trace->status = -1;
+        }
+    }
+    return trace->status;
+}
+
+/**
+ * Free a slot in the buffer: grow it, or write out every buffered segment.
+ * Only called to append a segment that did not extend the last one, so the
+ * last one is complete too.
+ */
+static int gantt_trace_make_room(struct gantt_trace* trace) {
+    if (!trace->stream) {
+        if (trace->cap > INT_MAX / 2) {
+            return -1;
+        }
+        struct gantt_segment* grown = realloc(trace->segments,
+                                              sizeof(struct gantt_segment) * trace->cap * 2);
+        if (!grown) {
+            return -1;
+        }
+        trace->segments = grown;
+        trace->cap *= 2;
+        return 0;
+    }
+
+    size_t len = (size_t)trace->len;
+    if (fwrite(trace->segments, sizeof(struct gantt_segment), len, trace->stream) != len) {
+        return -1;
+    }
+    trace->len = 0;
+    return 0;
+}
+
+/**
+ * Record one dispatch; an rr_dispatch_fn whose context is a gantt_trace.
+ * A dispatch that continues the last segment's process right where it
+ * stopped extends that segment instead of adding one.
+ */
+void gantt_trace_record(void* ctx, int index, int start, int amount) {
+    struct gantt_trace* trace = ctx;
+    if (amount <= 0 || trace->status != 0) {
+        return;
+    }
+
+    if (trace->len > 0) {
+        struct gantt_segment* last = &trace->segments[trace->len - 1];
+        if (last->pid == index && last->start + last->length == start) {
+            last->length += amount;
+            return;
+        }
+    }
+
+    if (trace->len == trace->cap && gantt_trace_make_room(trace) != 0) {
+        trace->status = -1;
+        return;
+    }
+    trace->segments[trace->len++] = (struct gantt_segment){ index, start, amount };
+    trace->count++;
+}
+
+/**
+ * Write any buffered segments of a streaming trace and flush the stream. An
+ * in-memory trace keeps its segments.
+ *
+ * @return 0 if every segment was recorded, or -1 if any was lost.
+ */
+int gantt_trace_finish(struct gantt_trace* trace) {
+    if (trace->status == 0 && trace->stream) {
+        size_t len = (size_t)trace->len;
+        if (fwrite(trace->segments, sizeof(struct gantt_segment), len, trace->stream) != len
+            || fflush(trace->stream) != 0) {
+            trace->status = -1;
+        }
+        trace->len = 0;
+    }
+    return trace->status;
+}
+
+/** Free the trace's buffer; the stream, if any, is left open. */
+void gantt_trace_free(struct gantt_trace* trace) {
+    free(trace->segments);
+    trace->segments = NULL;
+    trace->len = 0;
+    trace->cap = 0;
+}
+
+/**
+ * fcfs_run() that also records its Gantt chart, one segment per process
+ * with a burst to run. fcfs_run() itself is untouched, so untraced runs pay
+ * nothing for tracing.
+ */
+int fcfs_run_traced(struct pcb* procs, int plen, struct gantt_trace* trace) {
+    if (!procs || plen <= 0) {
+        return 0;
+    }
+
+    if (trace) {
+        int time = 0;
+        for (int i = 0; i < plen; i++) {
+            if (procs[i].burst_left > 0) {
+                gantt_trace_record(trace, i, time, procs[i].burst_left);
+                time += procs[i].burst_left;
+            }
+        }
+    }
+    return fcfs_run(procs, plen);
+}
+
+/**
+ * rr_run() that also records its Gantt chart. The schedule comes from
+ * rr_run_skip() with gantt_trace_record() as its dispatch callback, so a
+ * process left to run alone for many quanta becomes a single segment.
+ * Produces exactly the same PCBs and return value as rr_run(), or returns -1
+ * with the PCBs untouched and the trace marked failed if rr_run_skip()
+ * cannot allocate.
+ */
+int rr_run_traced(struct pcb* procs, int plen, int quantum, struct gantt_trace* trace) {
+    if (!trace) {
+        return rr_run(procs, plen, quantum);
+    }
+
+    int time = rr_run_skip(procs, plen, quantum, gantt_trace_record, trace);
+    if (time < 0) {
+        trace->status = -1;
+    }
     return time;
 }
@@ -2,6 +2,8 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
 
 /** This struct contains various information about each process */
 struct pcb {
@@ -10,14 +12,175 @@ struct pcb {
     int wait;       /** The amount of time this process was stuck waiting */
 };
 
+/**
+ * Structure-of-arrays view of a PCB array. The pid of entry i is i; the other
+ * fields live in separate arrays so per-slice updates stream over just the
+ * data they need.
+ */
+struct pcb_table {
+    int len;         /** Number of processes */
+    int* burst_left; /** burst_left of each process */
+    int* wait;       /** wait of each process */
+};
+
+/**
+ * Wide-counter PCB for very long simulations: burst, wait and the schedulers'
+ * clock are 64-bit so totals do not overflow with large workloads.
+ */
+struct pcb64 {
+    int pid;            /** The process ID */
+    int64_t burst_left; /** The amount of burst left */
+    int64_t wait;       /** The amount of time this process was stuck waiting */
+};
+
+/** Bump allocator for PCB arrays that are all released together */
+struct pcb_arena {
+    unsigned char* base; /** Start of the arena's memory */
+    size_t capacity;     /** Size of the arena in bytes */
+    size_t used;         /** Bytes handed out since the last reset */
+};
+
+/** PCB for processes that do not all arrive at time 0 */
+struct apcb {
+    int pid;        /** The process ID */
+    int burst_left; /** The amount of burst left */
+    int wait;       /** The amount of time this process spent in the ready queue */
+    int arrival;    /** The time at which the process becomes ready */
+};
+
 
 struct pcb* init_procs(int* bursts, int blen);
+struct pcb* init_procs_into(struct pcb* dst, const int* bursts, int blen);
+void procs_reset(struct pcb* procs, const int* bursts, int plen);
 
 void printall(struct pcb* procs, int plen);
 void run_proc(struct pcb* procs, int plen, int current, int amount);
 
 int fcfs_run(struct pcb* procs, int plen);
+void fcfs_batch(const int* bursts, const int* offsets, int nwork, int* waits, int* totals);
+int sjf_run(struct pcb* procs, int plen);
+int srtf_run(struct apcb* procs, int plen);
+
+int pcb_table_init(struct pcb_table* table, const int* bursts, int blen);
+int pcb_table_from_procs(struct pcb_table* table, const struct pcb* procs, int plen);
+void pcb_table_to_procs(const struct pcb_table* table, struct pcb* procs);
+void pcb_table_free(struct pcb_table* table);
+void pcb_table_run_proc(struct pcb_table* table, int current, int amount);
+
+/** Runnable set for Round-Robin: bit i is set while procs[i].burst_left > 0 */
+struct rr_bitmap {
+    uint64_t* words; /** One bit per PCB, 64 PCBs per word */
+    int nwords;      /** Number of words in 'words' */
+    int plen;        /** Number of PCBs covered by the set */
+    int runnable;    /** Number of bits currently set */
+};
+
+/**
+ * Receives one dispatch of a schedule: the process at 'index' ran for
+ * 'amount' time units starting at time 'start'.
+ */
+typedef void (*rr_dispatch_fn)(void* ctx, int index, int start, int amount);
+
+/**
+ * Whether the host stores integers little-endian, as every binary format of
+ * this project (workloads, compressed streams, results and Gantt traces)
+ * does. Those formats are mapped and written in host order, so on a
+ * big-endian host they are refused rather than read or written byte-swapped.
+ */
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#define PARTA_LITTLE_ENDIAN 0
+#else
+#define PARTA_LITTLE_ENDIAN 1
+#endif
+
+/** One run of a process in a Gantt chart */
+struct gantt_segment {
+    int32_t pid;    /** Index of the process in the PCB array */
+    int32_t start;  /** Time at which the run started */
+    int32_t length; /** Length of the run */
+};
+
+/**
+ * Run-length-encoded Gantt chart. Consecutive dispatches of the same process
+ * are merged into one segment, so a long burst under a small quantum costs
+ * one entry instead of one per slice.
+ */
+struct gantt_trace {
+    struct gantt_segment* segments; /** Segments not yet written to 'stream' */
+    int len;                        /** Number of entries in 'segments' */
+    int cap;                        /** Capacity of 'segments' */
+    FILE* stream;                   /** Binary sink for full buffers, or NULL */
+    int64_t count;                  /** Segments recorded so far */
+    int status;                     /** 0, or -1 once memory or the stream failed */
+};
+
+/** Segments buffered by a streaming gantt_trace between writes */
+#define GANTT_STREAM_SEGMENTS 4096
+
+/** Magic number opening a streamed Gantt trace */
+#define GANTT_MAGIC "PARTAGT1"
+
+/** How rr_run_engine() picks the next process */
+enum rr_engine {
+    RR_ENGINE_SCAN,   /** rr_next(): linear scans over the PCB array */
+    RR_ENGINE_BITMAP, /** rr_bitmap_next(): word-at-a-time bitmap search */
+};
+
+/** cfs_run() weight of a default-priority process (nice 0) */
+#define CFS_NICE0_WEIGHT 1024
+
+/**
+ * stride_run() stride of a process holding a single ticket. Any ticket count
+ * up to INT_MAX still gets a stride >= 2, and passes stay below 2^63 over the
+ * longest int schedule.
+ */
+#define STRIDE1 (UINT64_C(1) << 32)
+
+/** Most levels mlfq_run() supports: one bit per level in a 64-bit word */
+#define MLFQ_MAX_LEVELS 64
 
 int rr_next(int current, struct pcb* procs, int plen);
 int rr_run(struct pcb* procs, int plen, int quantum);
+int rr_solve(struct pcb* procs, int plen, int quantum);
+void rr_batch(const int* bursts, const int* offsets, int nwork, int quantum,
+              int* waits, int* totals);
+int cfs_run(struct pcb* procs, int plen, const int* weights, int min_granularity);
+int lottery_run(struct pcb* procs, int plen, const int* tickets, int quantum, uint64_t seed);
+int stride_run(struct pcb* procs, int plen, const int* tickets, int quantum);
+uint64_t sched_rand_next(uint64_t* state);
+uint64_t sched_rand_below(uint64_t* state, uint64_t bound);
+int drr_run(struct pcb* procs, int plen, const int* quanta);
+int mlfq_run(struct pcb* procs, int plen, int nlevels, const int* quanta);
+int rr_run_skip(struct pcb* procs, int plen, int quantum,
+                rr_dispatch_fn on_dispatch, void* ctx);
+
+int rr_bitmap_init(struct rr_bitmap* set, struct pcb* procs, int plen);
+void rr_bitmap_free(struct rr_bitmap* set);
+void rr_bitmap_update(struct rr_bitmap* set, struct pcb* procs, int i);
+int rr_bitmap_next(int current, const struct rr_bitmap* set);
+int rr_run_engine(struct pcb* procs, int plen, int quantum, enum rr_engine engine);
+
+struct pcb64* init_procs64(const int* bursts, int blen);
+struct pcb64* init_procs64_into(struct pcb64* dst, const int* bursts, int blen);
+void procs64_reset(struct pcb64* procs, const int* bursts, int plen);
+int64_t fcfs_run64(struct pcb64* procs, int plen);
+int64_t rr_run64(struct pcb64* procs, int plen, int quantum);
+size_t rr_scratch_size(int plen);
+int64_t rr_run64_scratch(struct pcb64* procs, int plen, int quantum, void* scratch);
+int64_t procs64_sum_wait(const struct pcb64* procs, int plen);
+
+struct apcb* init_aprocs(const int* bursts, const int* arrivals, int blen);
+int ev_fcfs_run(struct apcb* procs, int plen);
+int ev_rr_run(struct apcb* procs, int plen, int quantum);
+
+int pcb_arena_init(struct pcb_arena* arena, size_t capacity);
+void* pcb_arena_alloc(struct pcb_arena* arena, size_t size);
+void pcb_arena_reset(struct pcb_arena* arena);
+void pcb_arena_free(struct pcb_arena* arena);
 
+int gantt_trace_init(struct gantt_trace* trace, FILE* stream);
+void gantt_trace_record(void* trace, int index, int start, int amount);
+int gantt_trace_finish(struct gantt_trace* trace);
+void gantt_trace_free(struct gantt_trace* trace);
+int fcfs_run_traced(struct pcb* procs, int plen, struct gantt_trace* trace);
+int rr_run_traced(struct pcb* procs, int plen, int quantum, struct gantt_trace* trace);
@@ -0,0 +1,881 @@
+#include "parta_io.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/** Initial capacity of the burst array; it doubles whenever it fills up. */
+#define BURST_PARSER_MIN_CAP 4096
+
+/** Prepare an empty parser. */
+void burst_parser_init(struct burst_parser* parser) {
+    memset(parser, 0, sizeof(*parser));
+}
+
+/** Append one burst, growing the array geometrically. */
+static int burst_parser_push(struct burst_parser* parser, int value) {
+    if (parser->len == parser->cap) {
+        if (parser->cap > INT_MAX / 2) {
+            return -1;
+        }
+        int cap = parser->cap ? parser->cap * 2 : BURST_PARSER_MIN_CAP;
+        int* grown = realloc(parser->bursts, sizeof(int) * (size_t)cap);
+        if (!grown) {
+            return -1;
+        }
+        parser->bursts = grown;
+        parser->cap = cap;
+    }
+    parser->bursts[parser->len++] = value;
+    return 0;
+}
+
+/** Close the current token, if any. */
+static int burst_parser_end_token(struct burst_parser* parser) {
+    if (parser->sign == 0) {
+        return 0;
+    }
+    if (parser->digits == 0) {
+        return PARTA_IO_INVALID;
+    }
+
+    int value = (int)(parser->sign * parser->value);
+    parser->sign = 0;
+    parser->digits = 0;
+    parser->value = 0;
+    return burst_parser_push(parser, value);
+}
+
+/** Whether 'c' separates bursts in a text workload. */
+int burst_is_space(char c) {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/**
+ * Parse the next 'size' bytes of whitespace-separated decimal bursts.
+ *
+ * Each token is an optional sign followed by digits and must fit in an int;
+ * anything else is rejected rather than read as 0 the way atoi() would.
+ *
+ * @return 0 on success, -1 if memory cannot be allocated, or
+ *         PARTA_IO_INVALID if the text holds an invalid token.
+ */
+int burst_parser_feed(struct burst_parser* parser, const char* text, size_t size) {
+    const char* end = text + size;
+
+    for (const char* p = text; p < end; p++) {
+        unsigned digit = (unsigned)(*p - '0');
+        if (digit < 10 && parser->sign != 0) {
+            parser->value = parser->value * 10 + digit;
+            parser->digits++;
+            if (parser->value > (int64_t)INT_MAX + (parser->sign < 0)) {
+                return PARTA_IO_INVALID;
+            }
+        } else if (burst_is_space(*p)) {
+            int status = burst_parser_end_token(parser);
+            if (status != 0) {
+                return status;
+            }
+        } else if (parser->sign == 0 && (digit < 10 || *p == '-' || *p == '+')) {
+            parser->sign = (*p == '-') ? -1 : 1;
+            parser->value = (digit < 10) ? digit : 0;
+            parser->digits = (digit < 10);
+        } else {
+            return PARTA_IO_INVALID;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Close the last token and hand the bursts over to the caller, who must
+ * free() them. The parser is left empty.
+ *
+ * @return The number of bursts, -1 if memory cannot be allocated, or
+ *         PARTA_IO_INVALID if the text ends in an invalid token.
+ */
+int burst_parser_finish(struct burst_parser* parser, int** bursts) {
+    int status = burst_parser_end_token(parser);
+    if (status != 0) {
+        burst_parser_free(parser);
+        return status;
+    }
+
+    int len = parser->len;
+    *bursts = parser->bursts;
+    burst_parser_init(parser);
+    return len;
+}
+
+/** Release the bursts of a parser that was not finished. */
+void burst_parser_free(struct burst_parser* parser) {
+    free(parser->bursts);
+    burst_parser_init(parser);
+}
+
+/** Bit i is set if text[i] is a decimal digit, for the 16 bytes at 'text'. */
+static unsigned digit_mask16(const char* text) {
+#ifdef __SSE2__
+    __m128i bytes = _mm_loadu_si128((const __m128i*)text);
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('0' - 1)),
+                                  _mm_cmplt_epi8(bytes, _mm_set1_epi8('9' + 1)));
+    return (unsigned)_mm_movemask_epi8(digit);
+#else
+    unsigned mask = 0;
+    for (int i = 0; i < 16; i++) {
+        mask |= (unsigned)((unsigned)(text[i] - '0') < 10) << i;
+    }
+    return mask;
+#endif
+}
+
+/**
+ * Value of the 'len' (1 to 8) digits at 'text', with 8 readable bytes there.
+ * All eight digits are combined at once with three multiplies (SWAR).
+ */
+static uint32_t parse_digits8(const char* text, size_t len) {
+    uint64_t v;
+    memcpy(&v, text, 8);
+    // Bytes past the token are dropped by the shift, which also moves zero
+    // bytes in as leading zeros; borrows from them only run further up.
+    v -= 0x3030303030303030ULL;
+    v <<= 8 * (8 - len);
+    v = v * 10 + (v >> 8);
+    v = ((v & 0x000000ff000000ffULL) * (100 + (1000000ULL << 32))
+         + ((v >> 16) & 0x000000ff000000ffULL) * (1 + (10000ULL << 32))) >> 32;
+    return (uint32_t)v;
+}
+
+/**
+ * Parse a chunk of whitespace-separated decimal bursts that holds whole
+ * tokens only, appending them to 'parser' (which must be between tokens).
+ * Accepts and rejects exactly what burst_parser_feed() does.
+ *
+ * Digit runs are found 16 bytes at a time with SSE2 and tokens of up to
+ * eight digits are converted without a per-digit loop, so this is the fast
+ * path for text already in memory, such as a mapped file.
+ *
+ * @return 0 on success, -1 if memory cannot be allocated, or
+ *         PARTA_IO_INVALID if the text holds an invalid token.
+ */
+int burst_parser_feed_whole(struct burst_parser* parser, const char* text, size_t size) {
+    const char* p = text;
+    const char* end = text + size;
+
+    while (p < end) {
+        if (burst_is_space(*p)) {
+            p++;
+            continue;
+        }
+
+        int negative = (*p == '-');
+        if (*p == '-' || *p == '+') {
+            p++;
+        }
+
+        size_t len = 0;
+        for (;;) {
+            if (end - (p + len) < 16) {
+                while (p + len < end && (unsigned)(p[len] - '0') < 10) {
+                    len++;
+                }
+                break;
+            }
+            unsigned run = (unsigned)__builtin_ctz(~digit_mask16(p + len) | 0x10000u);
+            len += run;
+            if (run < 16) {
+                break;
+            }
+        }
+        if (len == 0 || (p + len < end && !burst_is_space(p[len]))) {
+            return PARTA_IO_INVALID;
+        }
+
+        int64_t value;
+        if (len <= 8 && end - p >= 8) {
+            value = parse_digits8(p, len);
+        } else {
+            value = 0;
+            for (size_t i = 0; i < len; i++) {
+                value = value * 10 + (p[i] - '0');
+                if (value > (int64_t)INT_MAX + negative) {
+                    return PARTA_IO_INVALID;
+                }
+            }
+        }
+        if (burst_parser_push(parser, (int)(negative ? -value : value)) != 0) {
+            return -1;
+        }
+        p += len;
+    }
+
+    return 0;
+}
+
+/** Buffered reader over a compressed workload stream */
+struct vz_stream {
+    int fd;
+    unsigned char* buffer; /** PARTA_IO_BUFSIZE bytes */
+    size_t start;          /** First unconsumed byte */
+    size_t end;            /** End of the buffered bytes */
+};
+
+/**
+ * Make sure at least 'need' unconsumed bytes are buffered, moving them to
+ * the front of the buffer first if necessary.
+ *
+ * @return 0 on success, -1 if reading fails, or PARTA_IO_INVALID if the
+ *         stream ends early.
+ */
+static int vz_fill(struct vz_stream* s, size_t need) {
+    if (s->end - s->start >= need) {
+        return 0;
+    }
+    if (s->start + need > PARTA_IO_BUFSIZE) {
+        memmove(s->buffer, s->buffer + s->start, s->end - s->start);
+        s->end -= s->start;
+        s->start = 0;
+    }
+    while (s->end - s->start < need) {
+        ssize_t got = read(s->fd, s->buffer + s->end, PARTA_IO_BUFSIZE - s->end);
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+        if (got < 0) {
+            return -1;
+        }
+        if (got == 0) {
+            return PARTA_IO_INVALID;
+        }
+        s->end += (size_t)got;
+    }
+    return 0;
+}
+
+static uint32_t vz_load32(const unsigned char* p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+/**
+ * Decode one block of 'nvalues' bursts from exactly 'nbytes' bytes.
+ *
+ * Small deltas, the common case for real traces, take one byte each; while
+ * the next 16 bytes are all single-byte varints the SSE2 path zigzag-decodes
+ * and prefix-sums them 16 at a time.
+ *
+ * @return 0 on success, or PARTA_IO_INVALID if the block is malformed.
+ */
+static int vz_decode_block(const unsigned char* p, size_t nbytes, int nvalues, int* out) {
+    const unsigned char* end = p + nbytes;
+    uint32_t prev = 0;
+    int i = 0;
+
+    while (i < nvalues) {
+#ifdef __SSE2__
+        if (nvalues - i >= 16 && end - p >= 16) {
+            __m128i bytes = _mm_loadu_si128((const __m128i*)p);
+            if (_mm_movemask_epi8(bytes) == 0) {
+                const __m128i zero = _mm_setzero_si128();
+                const __m128i one = _mm_set1_epi32(1);
+                __m128i run = _mm_set1_epi32((int)prev);
+                __m128i half[2] = { _mm_unpacklo_epi8(bytes, zero), _mm_unpackhi_epi8(bytes, zero) };
+                for (int h = 0; h < 4; h++) {
+                    __m128i v = (h & 1) ? _mm_unpackhi_epi16(half[h >> 1], zero)
+                                        : _mm_unpacklo_epi16(half[h >> 1], zero);
+                    __m128i d = _mm_xor_si128(_mm_srli_epi32(v, 1),
+                                              _mm_sub_epi32(zero, _mm_and_si128(v, one)));
+                    d = _mm_add_epi32(d, _mm_slli_si128(d, 4));
+                    d = _mm_add_epi32(d, _mm_slli_si128(d, 8));
+                    d = _mm_add_epi32(d, run);
+                    _mm_storeu_si128((__m128i*)(out + i + 4 * h), d);
+                    run = _mm_shuffle_epi32(d, 0xff);
+                }
+                prev = (uint32_t)out[i + 15];
+                p += 16;
+                i += 16;
+                continue;
+            }
+        }
+#endif
+        uint32_t zz = 0;
+        for (int shift = 0;; shift += 7) {
+            if (p == end || (shift == 28 && *p > 0x0f)) {
+                return PARTA_IO_INVALID;
+            }
+            zz |= (uint32_t)(*p & 0x7f) << shift;
+            if (!(*p++ & 0x80)) {
+                break;
+            }
+        }
+        prev += (zz >> 1) ^ (0u - (zz & 1));
+        out[i++] = (int)prev;
+    }
+
+    return (p == end) ? 0 : PARTA_IO_INVALID;
+}
+
+/**
+ * Decode a compressed workload stream whose first 'have' bytes are already
+ * in 'buffer' (a PARTA_IO_BUFSIZE buffer). Blocks are decoded straight from
+ * the buffer into the growing burst array.
+ */
+static int vz_read(int fd, unsigned char* buffer, size_t have, int** bursts) {
+    struct vz_stream s = { fd, buffer, 0, have };
+    int status = vz_fill(&s, sizeof(struct vz_header));
+    if (status != 0) {
+        return status;
+    }
+
+    struct vz_header header;
+    memcpy(&header, buffer, sizeof(header));
+    s.start += sizeof(header);
+    if (!PARTA_LITTLE_ENDIAN || header.version != 1 || header.block == 0 || header.block > VZ_MAX_BLOCK_VALUES
+        || header.count > INT_MAX) {
+        return PARTA_IO_INVALID;
+    }
+
+    int* out = NULL;
+    int len = 0, cap = 0;
+    while (status == 0 && (uint64_t)len < header.count) {
+        status = vz_fill(&s, 8);
+        if (status != 0) {
+            break;
+        }
+        uint32_t nvalues = vz_load32(buffer + s.start);
+        uint32_t nbytes = vz_load32(buffer + s.start + 4);
+        s.start += 8;
+        if (nvalues == 0 || nvalues > header.block || nvalues > header.count - (uint64_t)len
+            || nbytes > 5 * nvalues) {
+            status = PARTA_IO_INVALID;
+            break;
+        }
+
+        // Grow geometrically rather than trusting the header's count up front.
+        if (len + (int)nvalues > cap) {
+            int64_t grown = cap ? 2 * (int64_t)cap : BURST_PARSER_MIN_CAP;
+            grown = (grown < len + (int64_t)nvalues) ? len + (int64_t)nvalues : grown;
+            grown = (grown > (int64_t)header.count) ? (int64_t)header.count : grown;
+            int* larger = realloc(out, sizeof(int) * (size_t)grown);
+            if (!larger) {
+                status = -1;
+                break;
+            }
+            out = larger;
+            cap = (int)grown;
+        }
+
+        status = vz_fill(&s, nbytes);
+        if (status == 0) {
+            status = vz_decode_block(buffer + s.start, nbytes, (int)nvalues, out + len);
+        }
+        s.start += nbytes;
+        len += (int)nvalues;
+    }
+
+    if (status != 0) {
+        free(out);
+        return status;
+    }
+    *bursts = out;
+    return len;
+}
+
+/**
+ * Read bursts from a file descriptor until end of file: either
+ * whitespace- or newline-separated text, or a compressed workload stream
+ * (see struct vz_header), told apart by the stream's first bytes.
+ *
+ * The input is read PARTA_IO_BUFSIZE bytes at a time and parsed in place by
+ * burst_parser_feed() or decoded block by block, so memory use is the burst
+ * array plus one buffer.
+ *
+ * @param bursts Receives a heap array of the bursts, to be free()d by the
+ *               caller; left untouched on failure.
+ * @return       The number of bursts read, -1 if reading or allocation
+ *               fails, or PARTA_IO_INVALID if the input holds an invalid
+ *               token or is a malformed compressed stream.
+ */
+int read_bursts_fd(int fd, int** bursts) {
+    if (fd < 0 || !bursts) {
+        return -1;
+    }
+
+    char* buffer = malloc(PARTA_IO_BUFSIZE);
+    if (!buffer) {
+        return -1;
+    }
+
+    // Buffer at least a magic number's worth before deciding on the format.
+    size_t have = 0;
+    int status = 0;
+    while (have < 8) {
+        ssize_t got = read(fd, buffer + have, PARTA_IO_BUFSIZE - have);
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+        if (got <= 0) {
+            status = (got < 0) ? -1 : 0;
+            break;
+        }
+        have += (size_t)got;
+    }
+    if (status == 0 && have >= 8 && memcmp(buffer, VZ_MAGIC, 8) == 0) {
+        status = vz_read(fd, (unsigned char*)buffer, have, bursts);
+        free(buffer);
+        return status;
+    }
+
+    struct burst_parser parser;
+    burst_parser_init(&parser);
+    if (status == 0) {
+        status = burst_parser_feed(&parser, buffer, have);
+    }
+
+    while (status == 0 && have > 0) {
+        ssize_t got = read(fd, buffer, PARTA_IO_BUFSIZE);
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+        if (got <= 0) {
+            status = (got < 0) ? -1 : 0;
+            break;
+        }
+        status = burst_parser_feed(&parser, buffer, (size_t)got);
+    }
+    free(buffer);
+
+    if (status != 0) {
+        burst_parser_free(&parser);
+        return status;
+    }
+    return burst_parser_finish(&parser, bursts);
+}
+
+/**
+ * Read bursts like read_bursts_fd() from the file at 'path', or from
+ * standard input if 'path' is "-".
+ */
+int read_bursts_path(const char* path, int** bursts) {
+    if (!path) {
+        return -1;
+    }
+    if (strcmp(path, "-") == 0) {
+        return read_bursts_fd(STDIN_FILENO, bursts);
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    int status = read_bursts_fd(fd, bursts);
+    close(fd);
+    return status;
+}
+
+/** Size of a workload section of 'count' values of 'width' bytes, padded to 8 */
+static uint64_t workload_section(uint64_t count, uint64_t width) {
+    return (count * width + 7) & ~(uint64_t)7;
+}
+
+/**
+ * Map a binary workload file (see struct workload_header) read-only. The
+ * bursts, arrivals and weights are used in place, so opening even a very
+ * large workload costs one mmap(2) and the pages are read as the schedulers
+ * touch them.
+ *
+ * Anything but a regular file (a pipe, a FIFO, a terminal) is turned away
+ * with PARTA_IO_INVALID before it is opened, so no input is consumed and the
+ * caller can still read it as a stream.
+ *
+ * @return 0 on success, -1 if the file cannot be opened or mapped, or
+ *         PARTA_IO_INVALID if it is not a regular file, not a valid workload
+ *         file, or the host is not little-endian.
+ */
+int workload_open(struct workload* wl, const char* path) {
+    if (!wl || !path) {
+        return -1;
+    }
+    memset(wl, 0, sizeof(*wl));
+    if (!PARTA_LITTLE_ENDIAN) {
+        return PARTA_IO_INVALID;
+    }
+
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return -1;
+    }
+    if (!S_ISREG(st.st_mode)) {
+        return PARTA_IO_INVALID;
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        close(fd);
+        return PARTA_IO_INVALID;
+    }
+    if ((uint64_t)st.st_size < sizeof(struct workload_header)) {
+        close(fd);
+        return PARTA_IO_INVALID;
+    }
+
+    void* map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        return -1;
+    }
+
+    const struct workload_header* header = map;
+    uint64_t count = header->count;
+    uint32_t flags = header->flags;
+    uint64_t bursts = workload_section(count, (flags & WORKLOAD_BURST64) ? 8 : 4);
+    uint64_t extra = workload_section(count, 4);
+    uint64_t need = sizeof(struct workload_header) + bursts
+                  + ((flags & WORKLOAD_ARRIVALS) ? extra : 0)
+                  + ((flags & WORKLOAD_WEIGHTS) ? extra : 0);
+
+    if (memcmp(header->magic, WORKLOAD_MAGIC, 8) != 0 || header->version != 1
+        || (flags & ~(WORKLOAD_BURST64 | WORKLOAD_ARRIVALS | WORKLOAD_WEIGHTS))
+        || count > INT_MAX || need > (uint64_t)st.st_size) {
+        munmap(map, (size_t)st.st_size);
+        return PARTA_IO_INVALID;
+    }
+
+    const char* at = (const char*)map + sizeof(struct workload_header);
+    wl->map = map;
+    wl->size = (size_t)st.st_size;
+    wl->count = (int)count;
+    wl->flags = flags;
+    if (flags & WORKLOAD_BURST64) {
+        wl->bursts64 = (const int64_t*)at;
+    } else {
+        wl->bursts = (const int32_t*)at;
+    }
+    at += bursts;
+    if (flags & WORKLOAD_ARRIVALS) {
+        wl->arrivals = (const int32_t*)at;
+        at += extra;
+    }
+    if (flags & WORKLOAD_WEIGHTS) {
+        wl->weights = (const int32_t*)at;
+    }
+    return 0;
+}
+
+/** Unmap a workload opened by workload_open(); a zeroed workload is ignored. */
+void workload_close(struct workload* wl) {
+    if (wl && wl->map) {
+        munmap(wl->map, wl->size);
+    }
+    if (wl) {
+        memset(wl, 0, sizeof(*wl));
+    }
+}
+
+/**
+ * Write all 'size' bytes to 'fd', retrying short writes.
+ *
+ * @return 0 on success, or -1 on failure.
+ */
+int write_all(int fd, const void* data, size_t size) {
+    const char* p = data;
+    while (size > 0) {
+        ssize_t put = write(fd, p, size);
+        if (put < 0 && errno == EINTR) {
+            continue;
+        }
+        if (put <= 0) {
+            return -1;
+        }
+        p += put;
+        size -= (size_t)put;
+    }
+    return 0;
+}
+
+/** Write one int32 section followed by its padding. */
+static int workload_write_section(int fd, const int* values, int count) {
+    static const char padding[8];
+    size_t size = sizeof(int32_t) * (size_t)count;
+    if (write_all(fd, values, size) != 0) {
+        return -1;
+    }
+    return write_all(fd, padding, workload_section((uint64_t)count, 4) - size);
+}
+
+/**
+ * Write a binary workload file with int32 bursts and, if not NULL, arrival
+ * times and weights, replacing any file at 'path'.
+ *
+ * @return 0 on success, or -1 if the file cannot be written or the host is
+ *         not little-endian.
+ */
+int workload_write(const char* path, const int* bursts, const int* arrivals, const int* weights,
+                   int blen) {
+    if (!path || !bursts || blen < 0 || !PARTA_LITTLE_ENDIAN) {
+        return -1;
+    }
+
+    struct workload_header header;
+    memcpy(header.magic, WORKLOAD_MAGIC, 8);
+    header.version = 1;
+    header.flags = (arrivals ? WORKLOAD_ARRIVALS : 0) | (weights ? WORKLOAD_WEIGHTS : 0);
+    header.count = (uint64_t)blen;
+
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return -1;
+    }
+    int status = write_all(fd, &header, sizeof(header));
+    if (status == 0) {
+        status = workload_write_section(fd, bursts, blen);
+    }
+    if (status == 0 && arrivals) {
+        status = workload_write_section(fd, arrivals, blen);
+    }
+    if (status == 0 && weights) {
+        status = workload_write_section(fd, weights, blen);
+    }
+    if (close(fd) != 0) {
+        status = -1;
+    }
+    return status;
+}
+
+/**
+ * Write bursts as a compressed workload stream (see struct vz_header),
+ * VZ_BLOCK_VALUES bursts per block, one write per block.
+ *
+ * @return 0 on success, or -1 if writing or allocation fails or the host is
+ *         not little-endian.
+ */
+int vz_write_fd(int fd, const int* bursts, int blen) {
+    if (fd < 0 || (!bursts && blen > 0) || blen < 0 || !PARTA_LITTLE_ENDIAN) {
+        return -1;
+    }
+
+    struct vz_header header;
+    memcpy(header.magic, VZ_MAGIC, 8);
+    header.version = 1;
+    header.block = VZ_BLOCK_VALUES;
+    header.count = (uint64_t)blen;
+    if (write_all(fd, &header, sizeof(header)) != 0) {
+        return -1;
+    }
+
+    unsigned char* block = malloc(8 + 5 * VZ_BLOCK_VALUES);
+    if (!block) {
+        return -1;
+    }
+
+    int status = 0;
+    for (int first = 0; first < blen && status == 0; first += VZ_BLOCK_VALUES) {
+        int nvalues = (blen - first < VZ_BLOCK_VALUES) ? blen - first : VZ_BLOCK_VALUES;
+        unsigned char* p = block + 8;
+        uint32_t prev = 0;
+        for (int i = first; i < first + nvalues; i++) {
+            uint32_t delta = (uint32_t)bursts[i] - prev;
+            uint32_t zz = (delta << 1) ^ (0u - (delta >> 31));
+            prev = (uint32_t)bursts[i];
+            while (zz >= 0x80) {
+                *p++ = (unsigned char)(zz | 0x80);
+                zz >>= 7;
+            }
+            *p++ = (unsigned char)zz;
+        }
+
+        uint32_t counts[2] = { (uint32_t)nvalues, (uint32_t)(p - block - 8) };
+        memcpy(block, counts, sizeof(counts));
+        status = write_all(fd, block, (size_t)(p - block));
+    }
+
+    free(block);
+    return status;
+}
+
+/** Write a compressed workload file like vz_write_fd(), replacing any file at 'path'. */
+int vz_write(const char* path, const int* bursts, int blen) {
+    if (!path) {
+        return -1;
+    }
+
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return -1;
+    }
+    int status = vz_write_fd(fd, bursts, blen);
+    if (close(fd) != 0) {
+        status = -1;
+    }
+    return status;
+}
+
+/**
+ * Set up a bulk writer to 'fd'. Output is collected in one large buffer and
+ * handed to write(2) a megabyte at a time, so listings of millions of lines
+ * cost a few hundred system calls and no printf() parsing.
+ *
+ * @return 0 on success, or -1 if the buffer cannot be allocated.
+ */
+int bulk_writer_init(struct bulk_writer* w, int fd) {
+    w->fd = fd;
+    w->len = 0;
+    w->buffer = malloc(BULK_WRITER_BUFSIZE);
+    w->status = w->buffer ? 0 : -1;
+    return w->status;
+}
+
+static void bulk_writer_flush(struct bulk_writer* w) {
+    if (w->status == 0 && w->len > 0) {
+        w->status = write_all(w->fd, w->buffer, w->len);
+    }
+    w->len = 0;
+}
+
+/** Append 'size' bytes; a failed writer drops everything. */
+void bulk_write(struct bulk_writer* w, const char* text, size_t size) {
+    if (w->status != 0) {
+        return;
+    }
+    if (w->len + size > BULK_WRITER_BUFSIZE) {
+        bulk_writer_flush(w);
+        if (size > BULK_WRITER_BUFSIZE) {
+            w->status = (w->status == 0) ? write_all(w->fd, text, size) : w->status;
+            return;
+        }
+    }
+    memcpy(w->buffer + w->len, text, size);
+    w->len += size;
+}
+
+void bulk_write_str(struct bulk_writer* w, const char* text) {
+    bulk_write(w, text, strlen(text));
+}
+
+/** Append 'value' in decimal, two digits at a time from a lookup table. */
+void bulk_write_int(struct bulk_writer* w, int64_t value) {
+    static const char pairs[201] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+    char text[20];
+    char* p = text + sizeof(text);
+    uint64_t magnitude = (value < 0) ? 0 - (uint64_t)value : (uint64_t)value;
+
+    while (magnitude >= 100) {
+        p -= 2;
+        memcpy(p, pairs + 2 * (magnitude % 100), 2);
+        magnitude /= 100;
+    }
+    if (magnitude >= 10) {
+        p -= 2;
+        memcpy(p, pairs + 2 * magnitude, 2);
+    } else {
+        *--p = (char)('0' + magnitude);
+    }
+    if (value < 0) {
+        *--p = '-';
+    }
+    bulk_write(w, p, (size_t)(text + sizeof(text) - p));
+}
+
+/**
+ * Write out whatever is buffered and release the buffer.
+ *
+ * @return 0 if everything was written, or -1 if a write failed.
+ */
+int bulk_writer_close(struct bulk_writer* w) {
+    bulk_writer_flush(w);
+    free(w->buffer);
+    w->buffer = NULL;
+    return w->status;
+}
+
+/**
+ * Look up a result format by its command-line name: "csv", "jsonl" or "bin".
+ *
+ * @return 0 on success, or -1 if the name is unknown.
+ */
+int result_format_parse(const char* name, enum result_format* format) {
+    static const char* names[] = { "csv", "jsonl", "bin" };
+    for (int f = 0; f < 3; f++) {
+        if (strcmp(name, names[f]) == 0) {
+            *format = (enum result_format)f;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Write the outcome of a run for every process, all of which arrived at 0:
+ * pid, original burst, wait, turnaround and completion time. A process with
+ * no burst to run never completes, and reports 0 for all three times.
+ *
+ * Rows are formatted straight into a bulk_writer, so no per-row strings are
+ * built and the file is written a megabyte at a time.
+ *
+ * @param bursts The bursts the PCBs were built from.
+ * @param procs  The PCBs after the run.
+ * @return       0 on success, or -1 if the results cannot be written, or
+ *               are RESULT_BIN and the host is not little-endian.
+ */
+int write_results(int fd, enum result_format format, const int* bursts,
+                  const struct pcb64* procs, int plen) {
+    if (!bursts || !procs || plen < 0 || (format == RESULT_BIN && !PARTA_LITTLE_ENDIAN)) {
+        return -1;
+    }
+
+    struct bulk_writer w;
+    if (bulk_writer_init(&w, fd) != 0) {
+        return -1;
+    }
+
+    if (format == RESULT_CSV) {
+        bulk_write_str(&w, "pid,burst,wait,turnaround,completion\n");
+    } else if (format == RESULT_BIN) {
+        struct result_header header;
+        memcpy(header.magic, RESULT_MAGIC, 8);
+        header.version = 1;
+        header.reserved = 0;
+        header.count = (uint64_t)plen;
+        bulk_write(&w, (const char*)&header, sizeof(header));
+    }
+
+    for (int i = 0; i < plen; i++) {
+        int64_t completion = (bursts[i] > 0) ? procs[i].wait + bursts[i] : 0;
+        int64_t wait = (bursts[i] > 0) ? procs[i].wait : 0;
+
+        if (format == RESULT_BIN) {
+            struct result_record record = { procs[i].pid, bursts[i], wait, completion, completion };
+            bulk_write(&w, (const char*)&record, sizeof(record));
+            continue;
+        }
+
+        bulk_write_str(&w, (format == RESULT_CSV) ? "" : "{\"pid\":");
+        bulk_write_int(&w, procs[i].pid);
+        bulk_write_str(&w, (format == RESULT_CSV) ? "," : ",\"burst\":");
+        bulk_write_int(&w, bursts[i]);
+        bulk_write_str(&w, (format == RESULT_CSV) ? "," : ",\"wait\":");
+        bulk_write_int(&w, wait);
+        bulk_write_str(&w, (format == RESULT_CSV) ? "," : ",\"turnaround\":");
+        bulk_write_int(&w, completion);
+        bulk_write_str(&w, (format == RESULT_CSV) ? "," : ",\"completion\":");
+        bulk_write_int(&w, completion);
+        bulk_write_str(&w, (format == RESULT_CSV) ? "\n" : "}\n");
+    }
+
+    return bulk_writer_close(&w);
+}
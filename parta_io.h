@@ -0,0 +1,147 @@
+#pragma once
+
+#include "parta.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/** Size of the buffer the burst readers fill with each read(2) */
+#define PARTA_IO_BUFSIZE (1 << 20)
+
+/** Returned by the burst readers when a token is not a valid int */
+#define PARTA_IO_INVALID (-2)
+
+/**
+ * Incremental state of the burst text parser, so tokens may straddle the
+ * boundary between two buffers.
+ */
+struct burst_parser {
+    int* bursts;   /** Bursts parsed so far */
+    int len;       /** Number of bursts parsed */
+    int cap;       /** Capacity of 'bursts' */
+    int sign;      /** 0 between tokens, otherwise +1 or -1 for the current one */
+    int digits;    /** Digits seen in the current token */
+    int64_t value; /** Magnitude of the current token */
+};
+
+void burst_parser_init(struct burst_parser* parser);
+int burst_parser_feed(struct burst_parser* parser, const char* text, size_t size);
+int burst_parser_feed_whole(struct burst_parser* parser, const char* text, size_t size);
+int burst_parser_finish(struct burst_parser* parser, int** bursts);
+void burst_parser_free(struct burst_parser* parser);
+int burst_is_space(char c);
+
+/** Magic number opening a binary workload file */
+#define WORKLOAD_MAGIC "PARTAWL1"
+
+/** Flags of a binary workload file */
+#define WORKLOAD_BURST64  0x1u /** Bursts are int64 rather than int32 */
+#define WORKLOAD_ARRIVALS 0x2u /** An int32 arrival time follows per process */
+#define WORKLOAD_WEIGHTS  0x4u /** An int32 weight follows per process */
+
+/**
+ * Header of a binary workload file. All fields are little-endian. It is
+ * followed by the bursts, then the arrivals and the weights if flagged, each
+ * section padded to a multiple of 8 bytes.
+ */
+struct workload_header {
+    char magic[8];    /** WORKLOAD_MAGIC, without the terminating NUL */
+    uint32_t version; /** Format version, currently 1 */
+    uint32_t flags;   /** WORKLOAD_* flags */
+    uint64_t count;   /** Number of processes */
+};
+
+/** A binary workload file mapped into memory; the arrays point into the map. */
+struct workload {
+    void* map;               /** Start of the mapping */
+    size_t size;             /** Size of the mapping */
+    int count;               /** Number of processes */
+    uint32_t flags;          /** WORKLOAD_* flags */
+    const int32_t* bursts;   /** int32 bursts, or NULL with WORKLOAD_BURST64 */
+    const int64_t* bursts64; /** int64 bursts, or NULL without WORKLOAD_BURST64 */
+    const int32_t* arrivals; /** Arrival times, or NULL */
+    const int32_t* weights;  /** Weights, or NULL */
+};
+
+/** Magic number opening a compressed workload stream */
+#define VZ_MAGIC "PARTAVZ1"
+
+/** Bursts per block written by vz_write_fd() */
+#define VZ_BLOCK_VALUES 4096
+
+/** Largest block a compressed stream may declare */
+#define VZ_MAX_BLOCK_VALUES 65536
+
+/**
+ * Header of a compressed workload stream. All fields are little-endian. It
+ * is followed by blocks of at most 'block' bursts, each a uint32 burst count
+ * and a uint32 byte count, then one LEB128 varint per burst holding the
+ * zigzag-encoded difference from the previous burst of the block (the first
+ * is taken relative to 0).
+ */
+struct vz_header {
+    char magic[8];    /** VZ_MAGIC, without the terminating NUL */
+    uint32_t version; /** Format version, currently 1 */
+    uint32_t block;   /** Maximum number of bursts per block */
+    uint64_t count;   /** Number of bursts in the stream */
+};
+
+int read_bursts_fd(int fd, int** bursts);
+int read_bursts_path(const char* path, int** bursts);
+
+int workload_open(struct workload* wl, const char* path);
+void workload_close(struct workload* wl);
+int workload_write(const char* path, const int* bursts, const int* arrivals, const int* weights,
+                   int blen);
+
+int vz_write_fd(int fd, const int* bursts, int blen);
+int vz_write(const char* path, const int* bursts, int blen);
+
+/** Size of the buffer a bulk_writer fills before each write(2) */
+#define BULK_WRITER_BUFSIZE (1 << 20)
+
+/** Buffered writer for large listings, formatting integers itself */
+struct bulk_writer {
+    int fd;       /** Destination */
+    char* buffer; /** BULK_WRITER_BUFSIZE bytes */
+    size_t len;   /** Bytes buffered */
+    int status;   /** 0, or -1 once a write has failed */
+};
+
+int bulk_writer_init(struct bulk_writer* w, int fd);
+void bulk_write(struct bulk_writer* w, const char* text, size_t size);
+void bulk_write_str(struct bulk_writer* w, const char* text);
+void bulk_write_int(struct bulk_writer* w, int64_t value);
+int bulk_writer_close(struct bulk_writer* w);
+
+/** Per-process result file formats of write_results() */
+enum result_format {
+    RESULT_CSV,   /** Header line, then "pid,burst,wait,turnaround,completion" rows */
+    RESULT_JSONL, /** One JSON object per line with the same fields */
+    RESULT_BIN,   /** struct result_header, then one struct result_record each */
+};
+
+/** Magic number opening a binary result file */
+#define RESULT_MAGIC "PARTARS1"
+
+/** Header of a binary result file; all fields are little-endian. */
+struct result_header {
+    char magic[8];     /** RESULT_MAGIC, without the terminating NUL */
+    uint32_t version;  /** Format version, currently 1 */
+    uint32_t reserved; /** Always 0 */
+    uint64_t count;    /** Number of records */
+};
+
+/** One process in a binary result file */
+struct result_record {
+    int32_t pid;        /** The process ID */
+    int32_t burst;      /** The original burst */
+    int64_t wait;       /** Time spent waiting */
+    int64_t turnaround; /** Time from arrival to completion */
+    int64_t completion; /** Time at which the process completed */
+};
+
+int result_format_parse(const char* name, enum result_format* format);
+int write_results(int fd, enum result_format format, const int* bursts,
+                  const struct pcb64* procs, int plen);
+
+int write_all(int fd, const void* data, size_t size);
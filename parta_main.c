@@ -1,22 +1,468 @@
 #include "parta.h"
+#include "parta_par.h"
+#include "parta_io.h"
+#include "parta_stats.h"
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
 #include <stdio.h>
+#include <unistd.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <errno.h>
+
+/**
+ * Parse a quantum range "LO:HI" or "LO:HI:STEP" (STEP defaults to 1).
+ *
+ * @return 0 on success, or -1 if the text is not a valid positive range or
+ *         any field exceeds INT_MAX.
+ */
+static int parse_range(const char* text, int* lo, int* hi, int* step) {
+    char* end;
+    long values[3] = { 0, 0, 1 };
+    int count = 0;
+
+    while (count < 3) {
+        errno = 0;
+        values[count] = strtol(text, &end, 10);
+        if (end == text || errno == ERANGE || values[count] > INT_MAX) {
+            return -1;
+        }
+        count++;
+        if (*end != ':') {
+            break;
+        }
+        text = end + 1;
+    }
+    if (*end != '\0' || count < 2) {
+        return -1;
+    }
+    if (values[0] <= 0 || values[1] < values[0] || values[2] <= 0) {
+        return -1;
+    }
+
+    *lo = (int)values[0];
+    *hi = (int)values[1];
+    *step = (int)values[2];
+    return 0;
+}
+
+/** Options accepted after the mode arguments */
+struct cli_options {
+    const char* input;         /** File to read bursts from ("-" for stdin), or NULL */
+    int threads;               /** Host threads to use, or 0 if not given */
+    bool quiet;                /** Print only the summary */
+    bool stats;                /** Also print wait and turnaround percentiles */
+    const char* output;        /** File to export per-process results to, or NULL */
+    enum result_format format; /** Format of the exported results */
+};
+
+/**
+ * Consume the "--name value" and "--flag" options starting at argv[*next], leaving *next
+ * at the first argument that is not an option.
+ *
+ * @return 0 on success, or -1 if an option is unknown or lacks its value.
+ */
+static int parse_options(int argc, char* argv[], int* next, struct cli_options* opts) {
+    opts->input = NULL;
+    opts->threads = 0;
+    opts->quiet = false;
+    opts->stats = false;
+    opts->output = NULL;
+    opts->format = RESULT_CSV;
+
+    while (*next < argc && strncmp(argv[*next], "--", 2) == 0) {
+        const char* name = argv[*next];
+        if (strcmp(name, "--quiet") == 0) {
+            opts->quiet = true;
+            *next += 1;
+            continue;
+        }
+        if (strcmp(name, "--stats") == 0) {
+            opts->stats = true;
+            *next += 1;
+            continue;
+        }
+        if (*next + 1 >= argc) {
+            return -1;
+        }
+        const char* value = argv[*next + 1];
+        if (strcmp(name, "--input") == 0) {
+            opts->input = value;
+        } else if (strcmp(name, "--threads") == 0) {
+            char* end;
+            long threads = strtol(value, &end, 10);
+            if (end == value || *end != '\0' || threads <= 0 || threads > 4096) {
+                return -1;
+            }
+            opts->threads = (int)threads;
+        } else if (strcmp(name, "--output") == 0) {
+            opts->output = value;
+        } else if (strcmp(name, "--format") == 0) {
+            if (result_format_parse(value, &opts->format) != 0) {
+                return -1;
+            }
+        } else {
+            return -1;
+        }
+        *next += 2;
+    }
+    return 0;
+}
+
+/** Bursts of one run, and what has to be released once it is done */
+struct burst_input {
+    const int* bursts;   /** The bursts */
+    int plen;            /** Number of bursts */
+    int* owned;          /** Heap array behind 'bursts' to free(), or NULL */
+    struct workload map; /** Binary workload behind 'bursts' to close, if mapped */
+};
+
+static void burst_input_free(struct burst_input* in) {
+    free(in->owned);
+    workload_close(&in->map);
+}
+
+/**
+ * Map a binary workload file, or else read it as text (on 'nthreads' host
+ * threads, see read_bursts_parallel()) or as a compressed stream. int32
+ * bursts are used straight from the mapping; int64 ones are narrowed into a
+ * copy.
+ *
+ * @return The number of bursts, or a negative read_bursts_fd() status.
+ */
+static int load_file(const char* path, int nthreads, struct burst_input* in) {
+    int status = (strcmp(path, "-") == 0) ? PARTA_IO_INVALID : workload_open(&in->map, path);
+    if (status == PARTA_IO_INVALID) {
+        status = read_bursts_parallel(path, nthreads, &in->owned);
+        in->bursts = in->owned;
+        return status;
+    }
+    if (status != 0) {
+        return status;
+    }
+
+    if (in->map.bursts) {
+        in->bursts = in->map.bursts;
+        return in->map.count;
+    }
+    in->owned = malloc(sizeof(int) * (size_t)(in->map.count ? in->map.count : 1));
+    if (!in->owned) {
+        return -1;
+    }
+    for (int i = 0; i < in->map.count; i++) {
+        int64_t burst = in->map.bursts64[i];
+        if (burst < INT_MIN || burst > INT_MAX) {
+            return PARTA_IO_INVALID;
+        }
+        in->owned[i] = (int)burst;
+    }
+    in->bursts = in->owned;
+    return in->map.count;
+}
+
+/**
+ * Gather the bursts from argv[first..] or, for "-" or --input, from a
+ * stream or a binary workload file. Errors are reported on the way.
+ *
+ * @return The number of bursts, or 0 on error. 'in' must be released with
+ *         burst_input_free() either way.
+ */
+static int load_bursts(int argc, char* argv[], int first, const struct cli_options* opts,
+                       struct burst_input* in) {
+    memset(in, 0, sizeof(*in));
+
+    const char* input = opts->input;
+    if (!input && first == argc - 1 && strcmp(argv[first], "-") == 0) {
+        input = "-";
+        first = argc;
+    }
+
+    if (input) {
+        if (first < argc) {
+            printf("ERROR: Invalid arguments\n");
+            return 0;
+        }
+        int plen = load_file(input, opts->threads, in);
+        if (plen == PARTA_IO_INVALID) {
+            printf("ERROR: Invalid burst\n");
+            return 0;
+        }
+        if (plen < 0) {
+            fprintf(stderr, "ERROR: Failed to read %s\n", input);
+            return 0;
+        }
+        if (plen == 0) {
+            printf("ERROR: Missing arguments\n");
+        }
+        in->plen = plen;
+        return plen;
+    }
+
+    int plen = argc - first;
+    if (plen <= 0) {
+        printf("ERROR: Missing arguments\n");
+        return 0;
+    }
+    in->owned = malloc(sizeof(int) * plen);
+    if (!in->owned) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        return 0;
+    }
+    for (int i = 0; i < plen; i++) {
+        in->owned[i] = atoi(argv[first + i]);
+    }
+    in->bursts = in->owned;
+    in->plen = plen;
+    return plen;
+}
+
+/**
+ * Convert a workload in any format accepted by --input ("-" for standard
+ * input) into a binary workload file that later runs can map, or with
+ * 'compress' into a compressed workload stream.
+ *
+ * @return The process exit status.
+ */
+static int run_convert(const char* from, const char* to, bool compress) {
+    if (!PARTA_LITTLE_ENDIAN) {
+        fprintf(stderr, "ERROR: Binary workloads need a little-endian host\n");
+        return 1;
+    }
+
+    struct burst_input in;
+    memset(&in, 0, sizeof(in));
+    int plen = load_file(from, 1, &in);
+    if (plen == PARTA_IO_INVALID) {
+        printf("ERROR: Invalid burst\n");
+        burst_input_free(&in);
+        return 1;
+    }
+    if (plen < 0) {
+        fprintf(stderr, "ERROR: Failed to read %s\n", from);
+        burst_input_free(&in);
+        return 1;
+    }
+
+    int status = compress ? vz_write(to, in.bursts, plen)
+                          : workload_write(to, in.bursts, NULL, NULL, plen);
+    burst_input_free(&in);
+    if (status != 0) {
+        fprintf(stderr, "ERROR: Failed to write %s\n", to);
+        return 1;
+    }
+
+    printf("%s %d bursts.\n", compress ? "Compressed" : "Converted", plen);
+    return 0;
+}
+
+/**
+ * Print one "Accepted P<i>: Burst <b>" line per process through a
+ * bulk_writer, which formats millions of lines far faster than printf().
+ *
+ * @return 0 on success, or -1 if the listing cannot be written.
+ */
+static int print_accepted(const int* bursts, int plen) {
+    struct bulk_writer w;
+    fflush(stdout);
+    if (bulk_writer_init(&w, STDOUT_FILENO) != 0) {
+        return -1;
+    }
+
+    for (int i = 0; i < plen; i++) {
+        bulk_write(&w, "Accepted P", 10);
+        bulk_write_int(&w, i);
+        bulk_write(&w, ": Burst ", 8);
+        bulk_write_int(&w, bursts[i]);
+        bulk_write(&w, "\n", 1);
+    }
+    return bulk_writer_close(&w);
+}
+
+/**
+ * Export the per-process results of a run to 'path' ("-" for standard
+ * output) in the requested format.
+ *
+ * @return 0 on success, or -1 if the file cannot be written.
+ */
+static int export_results(const char* path, enum result_format format, const int* bursts,
+                          const struct pcb64* procs, int plen) {
+    if (strcmp(path, "-") == 0) {
+        fflush(stdout);
+        return write_results(STDOUT_FILENO, format, bursts, procs, plen);
+    }
+
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return -1;
+    }
+    int status = write_results(fd, format, bursts, procs, plen);
+    if (close(fd) != 0) {
+        status = -1;
+    }
+    return status;
+}
+
+/** Print the mean and tail percentiles of one histogram on a line. */
+static void print_tails(const char* name, const struct histogram* hist) {
+    printf("%s: mean %.2f, p50 %lld, p90 %lld, p99 %lld, p99.9 %lld, max %lld\n", name,
+           histogram_mean(hist), (long long)histogram_percentile(hist, 50),
+           (long long)histogram_percentile(hist, 90), (long long)histogram_percentile(hist, 99),
+           (long long)histogram_percentile(hist, 99.9), (long long)hist->max);
+}
+
+/**
+ * Print wait and turnaround tails of a finished run, gathered afterwards in
+ * one pass over the PCBs into log-bucketed histograms rather than by sorting.
+ *
+ * @return 0 on success, or -1 if the histograms cannot be allocated.
+ */
+static int print_stats(const int* bursts, const struct pcb64* procs, int plen) {
+    struct histogram* hist = malloc(sizeof(struct histogram) * 2);
+    if (!hist) {
+        return -1;
+    }
+    histogram_init(&hist[0]);
+    histogram_init(&hist[1]);
+
+    procs64_stats(procs, bursts, plen, &hist[0], &hist[1]);
+    print_tails("Wait time", &hist[0]);
+    print_tails("Turnaround time", &hist[1]);
+
+    free(hist);
+    return 0;
+}
+
+/**
+ * Run FCFS or RR(quantum) once on wide-counter PCBs, so totals
+ * do not overflow on very large workloads, and print the accepted
+ * processes and the average wait time (only the latter if quiet).
+ *
+ * @return The process exit status.
+ */
+static int run_single(const int* bursts, int plen, bool rr, int quantum,
+                      const struct cli_options* opts) {
+    if (!opts->quiet) {
+        if (!rr) {
+            printf("Using FCFS\n\n");
+        } else {
+            printf("Using RR(%d).\n\n", quantum);
+        }
+
+        if (print_accepted(bursts, plen) != 0) {
+            fprintf(stderr, "ERROR: Failed to write the processes\n");
+            return 1;
+        }
+    }
+
+    struct pcb64* procs = init_procs64(bursts, plen);
+    if (!procs) {
+        fprintf(stderr, "ERROR: Failed to initialize processes\n");
+        return 1;
+    }
+
+    if (!rr) {
+        (void)fcfs_run64(procs, plen);
+    } else if (rr_run64(procs, plen, quantum) < 0) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        free(procs);
+        return 1;
+    }
+
+    // Summed exactly in 64 bits; only the final average is rounded.
+    int64_t sum_wait = procs64_sum_wait(procs, plen);
+    double avg_wait = (double)sum_wait / (double)plen;
+
+    printf("Average wait time: %.2f\n", avg_wait);
+
+    int status = 0;
+    if (opts->stats && print_stats(bursts, procs, plen) != 0) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        status = 1;
+    }
+    if (opts->output && export_results(opts->output, opts->format, bursts, procs, plen) != 0) {
+        fprintf(stderr, "ERROR: Failed to write %s\n", opts->output);
+        status = 1;
+    }
+
+    free(procs);
+    return status;
+}
+
+/**
+ * Run RR for every quantum in qlo, qlo + qstep, ... <= qhi on 'nthreads'
+ * host threads (see rr_sweep()) and print one table row each.
+ *
+ * @return The process exit status.
+ */
+static int run_sweep(const int* bursts, int plen, int qlo, int qhi, int qstep, int nthreads) {
+    int nrows = (qhi - qlo) / qstep + 1;
+    struct sweep_row* rows = malloc(sizeof(struct sweep_row) * nrows);
+    if (!rows) {
+        fprintf(stderr, "ERROR: Memory allocation failed\n");
+        return 1;
+    }
+
+    printf("Using RR sweep %d:%d:%d.\n\n", qlo, qhi, qstep);
+
+    if (rr_sweep(bursts, plen, qlo, qhi, qstep, nthreads, rows) != nrows) {
+        fprintf(stderr, "ERROR: Failed to run the sweep\n");
+        free(rows);
+        return 1;
+    }
+
+    printf("%8s %12s %16s %12s\n", "Quantum", "Avg wait", "Avg turnaround", "Total time");
+    for (int r = 0; r < nrows; r++) {
+        printf("%8d %12.2f %16.2f %12lld\n", rows[r].quantum, rows[r].avg_wait,
+               rows[r].avg_turnaround, (long long)rows[r].total_time);
+    }
+
+    free(rows);
+    return 0;
+}
 
 /**
  * Command-line front-end for the simple CPU scheduler.
  *
  * Usage:
- *   ./parta_main fcfs <burst0> <burst1> ...
- *   ./parta_main rr <quantum> <burst0> <burst1> ...
+ *   ./parta_main fcfs [options] <burst0> <burst1> ...
+ *   ./parta_main rr <quantum> [options] <burst0> <burst1> ...
+ *   ./parta_main sweep rr <lo>:<hi>[:<step>] [options] <burst0> <burst1> ...
+ *   ./parta_main convert <input> <binary file>
+ *   ./parta_main compress <input> <compressed file>
+ *
+ * Instead of being listed, the bursts may be streamed as whitespace- or
+ * newline-separated text from standard input ("-" in place of the bursts)
+ * or from a file:
+ *   --input FILE   Read the bursts from FILE ("-" for standard input); a
+ *                  binary workload file (see struct workload_header) is
+ *                  mapped and used in place, and a compressed one (see
+ *                  struct vz_header) is decoded as it streams in
+ *   --threads N    Parse a text --input FILE on N host threads, and run
+ *                  sweeps on N threads instead of one per host CPU
+ *   --quiet        Print only the average wait time, not the processes
+ *   --stats        Also print the mean, p50, p90, p99, p99.9 and maximum of
+ *                  the wait and turnaround times
+ *   --output FILE  Also write pid, burst, wait, turnaround and completion
+ *                  time of every process to FILE ("-" for standard output)
+ *   --format F     Format of --output: csv (default), jsonl or bin (see
+ *                  struct result_header)
+ *
+ * The convert and compress modes turn a workload in any of these formats
+ * ("-" for standard input) into a binary or a compressed workload file.
  *
  * It:
  *   - Parses the arguments.
- *   - Builds the PCB array via init_procs().
+ *   - Builds the wide-counter PCB array via init_procs64(), so totals do not
+ *     overflow on very large workloads.
  *   - Runs either FCFS or RR(quantum).
  *   - Prints the accepted processes and the average wait time (2 decimals).
  *
+ * The sweep mode parses the bursts once and runs RR for every quantum in the
+ * range on all host CPUs (see rr_sweep()), printing one table row each.
+ * Text input is validated: a burst that is not a plain decimal int is an
+ * error rather than 0.
+ *
  * On error (e.g., missing arguments), it prints:
  *   ERROR: Missing arguments
  * and exits with status code 1.
@@ -28,100 +474,62 @@ int main(int argc, char* argv[]) {
     }
 
     const char* alg = argv[1];
+    int quantum = 0;
+    int qlo = 0, qhi = 0, qstep = 0;
+    int next;
 
     if (strcmp(alg, "fcfs") == 0) {
         // Need at least one burst time: ./parta_main fcfs <burst...>
-        if (argc < 3) {
-            printf("ERROR: Missing arguments\n");
-            return 1;
-        }
-
-        int plen = argc - 2;
-        int* bursts = malloc(sizeof(int) * plen);
-        if (!bursts) {
-            fprintf(stderr, "ERROR: Memory allocation failed\n");
-            return 1;
-        }
-
-        for (int i = 0; i < plen; i++) {
-            bursts[i] = atoi(argv[2 + i]);
-        }
-
-        printf("Using FCFS\n\n");
-
-        for (int i = 0; i < plen; i++) {
-            printf("Accepted P%d: Burst %d\n", i, bursts[i]);
-        }
-
-        struct pcb* procs = init_procs(bursts, plen);
-        if (!procs) {
-            fprintf(stderr, "ERROR: Failed to initialize processes\n");
-            free(bursts);
-            return 1;
-        }
-
-        (void)fcfs_run(procs, plen);
-
-        double sum_wait = 0.0;
-        for (int i = 0; i < plen; i++) {
-            sum_wait += procs[i].wait;
-        }
-        double avg_wait = sum_wait / (double)plen;
-
-        printf("Average wait time: %.2f\n", avg_wait);
-
-        free(procs);
-        free(bursts);
+        next = 2;
     } else if (strcmp(alg, "rr") == 0) {
         // Need at least: ./parta_main rr <quantum> <burst...>
         if (argc < 4) {
             printf("ERROR: Missing arguments\n");
             return 1;
         }
-
-        int quantum = atoi(argv[2]);
-        int plen = argc - 3;
-
-        int* bursts = malloc(sizeof(int) * plen);
-        if (!bursts) {
-            fprintf(stderr, "ERROR: Memory allocation failed\n");
+        quantum = atoi(argv[2]);
+        next = 3;
+    } else if (strcmp(alg, "sweep") == 0) {
+        // Need at least: ./parta_main sweep rr <lo>:<hi> <burst...>
+        if (argc < 5 || strcmp(argv[2], "rr") != 0) {
+            printf("ERROR: Missing arguments\n");
             return 1;
         }
-
-        for (int i = 0; i < plen; i++) {
-            bursts[i] = atoi(argv[3 + i]);
-        }
-
-        printf("Using RR(%d).\n\n", quantum);
-
-        for (int i = 0; i < plen; i++) {
-            printf("Accepted P%d: Burst %d\n", i, bursts[i]);
-        }
-
-        struct pcb* procs = init_procs(bursts, plen);
-        if (!procs) {
-            fprintf(stderr, "ERROR: Failed to initialize processes\n");
-            free(bursts);
+        if (parse_range(argv[3], &qlo, &qhi, &qstep) != 0) {
+            printf("ERROR: Invalid quantum range\n");
             return 1;
         }
-
-        (void)rr_run(procs, plen, quantum);
-
-        double sum_wait = 0.0;
-        for (int i = 0; i < plen; i++) {
-            sum_wait += procs[i].wait;
+        next = 4;
+    } else if (strcmp(alg, "convert") == 0 || strcmp(alg, "compress") == 0) {
+        // Need: ./parta_main convert|compress <from> <to>
+        if (argc != 4) {
+            printf("ERROR: Missing arguments\n");
+            return 1;
         }
-        double avg_wait = sum_wait / (double)plen;
-
-        printf("Average wait time: %.2f\n", avg_wait);
-
-        free(procs);
-        free(bursts);
+        return run_convert(argv[2], argv[3], strcmp(alg, "compress") == 0);
     } else {
         // Algorithm not recognized
         printf("ERROR: Missing arguments\n");
         return 1;
     }
 
-    return 0;
+    struct cli_options opts;
+    if (parse_options(argc, argv, &next, &opts) != 0 || ((opts.output || opts.stats) && strcmp(alg, "sweep") == 0)) {
+        printf("ERROR: Invalid arguments\n");
+        return 1;
+    }
+
+    // Sweeps use every host CPU unless told otherwise.
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    int sweep_threads = opts.threads ? opts.threads : (ncpu > 0 ? (int)ncpu : 1);
+
+    struct burst_input in;
+    int status = 1;
+    if (load_bursts(argc, argv, next, &opts, &in) > 0) {
+        status = (strcmp(alg, "sweep") == 0)
+               ? run_sweep(in.bursts, in.plen, qlo, qhi, qstep, sweep_threads)
+               : run_single(in.bursts, in.plen, strcmp(alg, "rr") == 0, quantum, &opts);
+    }
+    burst_input_free(&in);
+    return status;
 }
@@ -0,0 +1,756 @@
+#include "parta_par.h"
+#include "parta_io.h"
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/** One simulated CPU: its run queue and what it is doing */
+struct smp_cpu {
+    int head;          /** Owner end of the run queue, or -1 if empty */
+    int tail;          /** Steal end of the run queue, or -1 if empty */
+    int len;           /** Number of queued processes */
+    int running;       /** Process whose slice ends at free_at, or -1 */
+    long long free_at; /** Time at which this CPU next acts */
+    struct smp_cpu_stats stats;
+};
+
+/** Shared state of one smp_run() */
+struct smp_sim {
+    struct pcb* procs;
+    int* next;             /** Run queue links, indexed like the PCBs */
+    int* prev;
+    struct smp_cpu* cpu;
+    int ncpu;
+    int ndomains;
+    int quantum;           /** Slice length, INT_MAX for FCFS */
+    long long epoch_end;   /** Boundary the domains are simulated up to */
+    int* completed;        /** Processes finished per domain this epoch */
+    long long* last;       /** Latest completion time per domain */
+    int nthreads;
+    pthread_mutex_t lock;  /** Guards the epoch hand-off fields below */
+    pthread_cond_t start;  /** Signalled when a new epoch begins, or on stop */
+    pthread_cond_t done;   /** Signalled when the last worker finishes an epoch */
+    long long epoch;       /** Epochs started so far */
+    int pending;           /** Started workers still simulating this epoch */
+    int stop;              /** Set once every epoch has been simulated */
+};
+
+static void smp_push_tail(struct smp_sim* sim, struct smp_cpu* c, int p) {
+    sim->next[p] = -1;
+    sim->prev[p] = c->tail;
+    if (c->tail == -1) {
+        c->head = p;
+    } else {
+        sim->next[c->tail] = p;
+    }
+    c->tail = p;
+    c->len++;
+}
+
+static int smp_pop_head(struct smp_sim* sim, struct smp_cpu* c) {
+    int p = c->head;
+    c->head = sim->next[p];
+    if (c->head == -1) {
+        c->tail = -1;
+    } else {
+        sim->prev[c->head] = -1;
+    }
+    c->len--;
+    return p;
+}
+
+static int smp_pop_tail(struct smp_sim* sim, struct smp_cpu* c) {
+    int p = c->tail;
+    c->tail = sim->prev[p];
+    if (c->tail == -1) {
+        c->head = -1;
+    } else {
+        sim->next[c->tail] = -1;
+    }
+    c->len--;
+    return p;
+}
+
+/** Move the last 'count' processes of victim's queue, in order, to thief's. */
+static void smp_steal(struct smp_sim* sim, struct smp_cpu* thief, struct smp_cpu* victim, int count) {
+    int first = victim->tail;
+    for (int k = 1; k < count; k++) {
+        first = sim->prev[first];
+    }
+    for (int k = 0; k < count; k++) {
+        int p = first;
+        first = sim->next[p];
+        // Unlink from the front of the stolen run, then append to the thief.
+        if (sim->prev[p] == -1) {
+            victim->head = sim->next[p];
+        } else {
+            sim->next[sim->prev[p]] = sim->next[p];
+        }
+        if (sim->next[p] == -1) {
+            victim->tail = sim->prev[p];
+        } else {
+            sim->prev[sim->next[p]] = sim->prev[p];
+        }
+        victim->len--;
+        smp_push_tail(sim, thief, p);
+    }
+    thief->stats.stolen += count;
+}
+
+/**
+ * Simulate the CPUs of domain 'd' up to sim->epoch_end, in exact time order.
+ *
+ * The CPU that acts next is the one with the earliest free_at (ties: lowest
+ * id). It requeues the process whose slice just ended, steals one process
+ * from the steal end of the longest queue in its domain if its own queue is
+ * empty, and dispatches from the owner end. A CPU with nothing to do parks
+ * until the next event in its domain or the end of the epoch.
+ */
+static void smp_simulate_domain(struct smp_sim* sim, int d) {
+    int lo = d * SMP_DOMAIN_CPUS;
+    int hi = (lo + SMP_DOMAIN_CPUS < sim->ncpu) ? lo + SMP_DOMAIN_CPUS : sim->ncpu;
+    struct pcb* procs = sim->procs;
+    struct smp_cpu* cpu = sim->cpu;
+    int completed = 0;
+    long long last = sim->last[d];
+
+    while (1) {
+        int c = lo;
+        for (int k = lo + 1; k < hi; k++) {
+            if (cpu[k].free_at < cpu[c].free_at) {
+                c = k;
+            }
+        }
+        if (cpu[c].free_at >= sim->epoch_end) {
+            break;
+        }
+        long long t = cpu[c].free_at;
+
+        if (cpu[c].running != -1) {
+            int p = cpu[c].running;
+            cpu[c].running = -1;
+            if (procs[p].burst_left > 0) {
+                smp_push_tail(sim, &cpu[c], p);
+            }
+        }
+
+        if (cpu[c].len == 0) {
+            int victim = -1;
+            for (int k = lo; k < hi; k++) {
+                if (cpu[k].len > 0 && (victim == -1 || cpu[k].len > cpu[victim].len)) {
+                    victim = k;
+                }
+            }
+            if (victim != -1) {
+                smp_steal(sim, &cpu[c], &cpu[victim], 1);
+            }
+        }
+
+        if (cpu[c].len == 0) {
+            long long wake = sim->epoch_end;
+            for (int k = lo; k < hi; k++) {
+                if (cpu[k].free_at > t && cpu[k].free_at < wake) {
+                    wake = cpu[k].free_at;
+                }
+            }
+            cpu[c].free_at = wake;
+            continue;
+        }
+
+        int p = smp_pop_head(sim, &cpu[c]);
+        int used = (procs[p].burst_left < sim->quantum) ? procs[p].burst_left : sim->quantum;
+        procs[p].burst_left -= used;
+        cpu[c].stats.busy += used;
+        cpu[c].stats.dispatched++;
+        cpu[c].running = p;
+        cpu[c].free_at = t + used;
+        if (procs[p].burst_left == 0) {
+            procs[p].wait += (int)(t + used); // see lazy accounting in smp_run()
+            completed++;
+            if (t + used > last) {
+                last = t + used;
+            }
+        }
+    }
+
+    sim->completed[d] = completed;
+    sim->last[d] = last;
+}
+
+/**
+ * Epoch boundary: every CPU that reached the boundary with an empty queue
+ * steals half of the globally longest queue (ties: lowest id), in CPU order.
+ */
+static void smp_rebalance(struct smp_sim* sim) {
+    for (int c = 0; c < sim->ncpu; c++) {
+        if (sim->cpu[c].len > 0 || sim->cpu[c].free_at > sim->epoch_end) {
+            continue;
+        }
+        int victim = -1;
+        for (int k = 0; k < sim->ncpu; k++) {
+            if (sim->cpu[k].len > 0 && (victim == -1 || sim->cpu[k].len > sim->cpu[victim].len)) {
+                victim = k;
+            }
+        }
+        if (victim == -1) {
+            return;
+        }
+        smp_steal(sim, &sim->cpu[c], &sim->cpu[victim], (sim->cpu[victim].len + 1) / 2);
+    }
+}
+
+/** Argument of an smp_run() worker thread */
+struct smp_worker {
+    struct smp_sim* sim;
+    int id;
+    int started; /** Whether a host thread is running this share */
+};
+
+/** Simulate this worker's share of the domains for the current epoch. */
+static void smp_run_domains(struct smp_sim* sim, int id) {
+    for (int d = id; d < sim->ndomains; d += sim->nthreads) {
+        smp_simulate_domain(sim, d);
+    }
+}
+
+/**
+ * Worker thread, started once per smp_run(): simulate this share of the
+ * domains every time an epoch begins, until the run stops.
+ */
+static void* smp_worker_main(void* arg) {
+    struct smp_worker* w = arg;
+    struct smp_sim* sim = w->sim;
+    long long seen = 0;
+
+    pthread_mutex_lock(&sim->lock);
+    while (1) {
+        while (sim->epoch == seen && !sim->stop) {
+            pthread_cond_wait(&sim->start, &sim->lock);
+        }
+        if (sim->stop) {
+            break;
+        }
+        seen = sim->epoch;
+        pthread_mutex_unlock(&sim->lock);
+
+        smp_run_domains(sim, w->id);
+
+        pthread_mutex_lock(&sim->lock);
+        if (--sim->pending == 0) {
+            pthread_cond_signal(&sim->done);
+        }
+    }
+    pthread_mutex_unlock(&sim->lock);
+    return NULL;
+}
+
+/**
+ * Simulate one epoch of every domain, spreading the domains over the host
+ * threads. The started workers are woken and waited for through sim->lock,
+ * which also publishes the queues between them and the rebalancing caller;
+ * a share whose thread could not be started runs on the caller.
+ */
+static void smp_run_epoch(struct smp_sim* sim, struct smp_worker* workers) {
+    int started = 0;
+    for (int k = 1; k < sim->nthreads; k++) {
+        started += workers[k].started;
+    }
+
+    pthread_mutex_lock(&sim->lock);
+    sim->pending = started;
+    sim->epoch++;
+    pthread_cond_broadcast(&sim->start);
+    pthread_mutex_unlock(&sim->lock);
+
+    smp_run_domains(sim, 0);
+    for (int k = 1; k < sim->nthreads; k++) {
+        if (!workers[k].started) {
+            smp_run_domains(sim, k);
+        }
+    }
+
+    pthread_mutex_lock(&sim->lock);
+    while (sim->pending > 0) {
+        pthread_cond_wait(&sim->done, &sim->lock);
+    }
+    pthread_mutex_unlock(&sim->lock);
+}
+
+/**
+ * Simulate 'ncpu' CPUs sharing the given processes, each CPU with its own
+ * run queue.
+ *
+ * Process i starts in the queue of CPU i % ncpu. A CPU runs processes from
+ * the owner (front) end of its queue, FCFS if quantum is 0 or Round-Robin
+ * with the given quantum otherwise, requeueing a preempted process at the
+ * back. An idle CPU steals from the back end of another queue, as in a
+ * Chase-Lev work-stealing deque: within its domain of SMP_DOMAIN_CPUS CPUs
+ * it steals one process the moment it goes idle, and at the end of every
+ * epoch it may steal half of the longest queue anywhere.
+ *
+ * Domains only interact at epoch boundaries, so within an epoch they are
+ * simulated concurrently on 'nthreads' host threads, started once and woken
+ * for every epoch rather than created per epoch. The result does not depend
+ * on 'nthreads'. The queues themselves need no atomics: each one is
+ * only touched by the thread simulating its domain, or by the single thread
+ * rebalancing at a boundary.
+ *
+ * Every process arrives at time 0, so waits are settled at completion as
+ * C - burst (see lazy_begin() in parta.c). Processes with burst_left <= 0
+ * are left untouched.
+ *
+ * @param quantum  Slice length, or 0 for FCFS.
+ * @param nthreads Host threads to use (<= 1 runs on the calling thread).
+ * @param stats    Receives ncpu per-CPU results, or NULL. Utilization of
+ *                 CPU c is stats[c].busy divided by the returned time.
+ * @return         The time at which the last process completes, 0 if the
+ *                 arguments are invalid, or -1 if memory cannot be
+ *                 allocated.
+ */
+int64_t smp_run(struct pcb* procs, int plen, int ncpu, int quantum, int nthreads,
+                struct smp_cpu_stats* stats) {
+    if (!procs || plen <= 0 || ncpu <= 0 || quantum < 0) {
+        return 0;
+    }
+
+    struct smp_sim sim;
+    sim.procs = procs;
+    sim.ncpu = ncpu;
+    sim.ndomains = (ncpu + SMP_DOMAIN_CPUS - 1) / SMP_DOMAIN_CPUS;
+    sim.quantum = (quantum == 0) ? INT_MAX : quantum;
+    sim.nthreads = (nthreads < 1) ? 1 : (nthreads > sim.ndomains ? sim.ndomains : nthreads);
+    sim.next = malloc(sizeof(int) * plen);
+    sim.prev = malloc(sizeof(int) * plen);
+    sim.cpu = calloc(ncpu, sizeof(struct smp_cpu));
+    sim.completed = calloc(sim.ndomains, sizeof(int));
+    sim.last = calloc(sim.ndomains, sizeof(long long));
+    struct smp_worker* workers = malloc(sizeof(struct smp_worker) * sim.nthreads);
+    pthread_t* threads = malloc(sizeof(pthread_t) * sim.nthreads);
+    if (!sim.next || !sim.prev || !sim.cpu || !sim.completed || !sim.last || !workers || !threads) {
+        free(sim.next);
+        free(sim.prev);
+        free(sim.cpu);
+        free(sim.completed);
+        free(sim.last);
+        free(workers);
+        free(threads);
+        return -1;
+    }
+
+    for (int c = 0; c < ncpu; c++) {
+        sim.cpu[c].head = sim.cpu[c].tail = sim.cpu[c].running = -1;
+    }
+    pthread_mutex_init(&sim.lock, NULL);
+    pthread_cond_init(&sim.start, NULL);
+    pthread_cond_init(&sim.done, NULL);
+    sim.epoch = 0;
+    sim.pending = 0;
+    sim.stop = 0;
+    int left = 0;
+    long long work = 0;
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) {
+            procs[i].wait -= procs[i].burst_left;
+            smp_push_tail(&sim, &sim.cpu[i % ncpu], i);
+            work += procs[i].burst_left;
+            left++;
+        }
+    }
+
+    // About 64 epochs if the load were perfectly balanced.
+    long long epoch = work / ((long long)ncpu * 64);
+    if (epoch < 1) {
+        epoch = 1;
+    }
+    sim.epoch_end = 0;
+
+    for (int k = 1; k < sim.nthreads; k++) {
+        workers[k] = (struct smp_worker){ &sim, k, 0 };
+        workers[k].started = pthread_create(&threads[k], NULL, smp_worker_main, &workers[k]) == 0;
+    }
+    while (left > 0) {
+        sim.epoch_end += epoch;
+        smp_run_epoch(&sim, workers);
+        for (int d = 0; d < sim.ndomains; d++) {
+            left -= sim.completed[d];
+        }
+        smp_rebalance(&sim);
+    }
+
+    pthread_mutex_lock(&sim.lock);
+    sim.stop = 1;
+    pthread_cond_broadcast(&sim.start);
+    pthread_mutex_unlock(&sim.lock);
+    for (int k = 1; k < sim.nthreads; k++) {
+        if (workers[k].started) {
+            pthread_join(threads[k], NULL);
+        }
+    }
+    pthread_mutex_destroy(&sim.lock);
+    pthread_cond_destroy(&sim.start);
+    pthread_cond_destroy(&sim.done);
+
+    int64_t makespan = 0;
+    for (int d = 0; d < sim.ndomains; d++) {
+        if (sim.last[d] > makespan) {
+            makespan = sim.last[d];
+        }
+    }
+    for (int c = 0; stats && c < ncpu; c++) {
+        stats[c] = sim.cpu[c].stats;
+    }
+
+    free(sim.next);
+    free(sim.prev);
+    free(sim.cpu);
+    free(sim.completed);
+    free(sim.last);
+    free(workers);
+    free(threads);
+    return makespan;
+}
+
+/** Shared state of one rr_sweep() */
+struct sweep_job {
+    const int* bursts;
+    int plen;
+    int64_t work;                 /** Sum of the positive bursts */
+    int qlo;
+    int qstep;
+    int nrows;
+    int nthreads;
+    struct sweep_row* rows;
+};
+
+/** Argument of an rr_sweep() worker thread */
+struct sweep_worker {
+    struct sweep_job* job;
+    int id;
+    struct pcb64* procs; /** This share's private PCBs */
+    void* scratch;       /** This share's rr_run64_scratch() working memory */
+    int started;         /** Whether a host thread is running this share */
+};
+
+/** Run every nthreads-th quantum of the sweep on the share's private PCBs. */
+static void* sweep_worker_main(void* arg) {
+    struct sweep_worker* w = arg;
+    struct sweep_job* job = w->job;
+    struct pcb64* procs = w->procs;
+
+    for (int r = w->id; r < job->nrows; r += job->nthreads) {
+        int quantum = job->qlo + r * job->qstep;
+        procs64_reset(procs, job->bursts, job->plen);
+        int64_t total_time = rr_run64_scratch(procs, job->plen, quantum, w->scratch);
+        int64_t sum_wait = procs64_sum_wait(procs, job->plen);
+
+        job->rows[r].quantum = quantum;
+        job->rows[r].avg_wait = (double)sum_wait / job->plen;
+        job->rows[r].avg_turnaround = (double)(sum_wait + job->work) / job->plen;
+        job->rows[r].total_time = total_time;
+    }
+
+    return NULL;
+}
+
+/**
+ * Run Round-Robin over the same bursts for every quantum in
+ * qlo, qlo + qstep, ... <= qhi.
+ *
+ * Each of the 'nthreads' host threads owns one PCB array and one
+ * rr_run64_scratch() working block, both carved from a single pcb_arena,
+ * and restores the PCBs with procs64_reset() before every run, so no memory
+ * is allocated per quantum and the threads share nothing but the read-only
+ * bursts and their own rows.
+ *
+ * @param rows Receives one row per quantum, in increasing quantum order;
+ *             must hold (qhi - qlo) / qstep + 1 rows.
+ * @return     The number of rows written, 0 if the arguments are invalid,
+ *             or -1 if memory cannot be allocated.
+ */
+int rr_sweep(const int* bursts, int blen, int qlo, int qhi, int qstep, int nthreads,
+             struct sweep_row* rows) {
+    if (!bursts || blen <= 0 || !rows || qlo <= 0 || qhi < qlo || qstep <= 0) {
+        return 0;
+    }
+
+    struct sweep_job job;
+    job.plen = blen;
+    job.qlo = qlo;
+    job.qstep = qstep;
+    job.nrows = (qhi - qlo) / qstep + 1;
+    job.nthreads = (nthreads < 1) ? 1 : (nthreads > job.nrows ? job.nrows : nthreads);
+    job.rows = rows;
+    job.work = 0;
+    for (int i = 0; i < blen; i++) {
+        if (bursts[i] > 0) {
+            job.work += bursts[i];
+        }
+    }
+
+    job.bursts = bursts;
+
+    struct pcb_arena arena;
+    size_t align = _Alignof(max_align_t);
+    size_t share = (sizeof(struct pcb64) * blen + align - 1) & ~(align - 1);
+    share += (rr_scratch_size(blen) + align - 1) & ~(align - 1);
+    if (pcb_arena_init(&arena, share * job.nthreads) != 0) {
+        return -1;
+    }
+    struct sweep_worker* workers = malloc(sizeof(struct sweep_worker) * job.nthreads);
+    pthread_t* threads = malloc(sizeof(pthread_t) * job.nthreads);
+    if (!workers || !threads) {
+        pcb_arena_free(&arena);
+        free(workers);
+        free(threads);
+        return -1;
+    }
+
+    for (int k = 0; k < job.nthreads; k++) {
+        struct pcb64* procs = pcb_arena_alloc(&arena, sizeof(struct pcb64) * blen);
+        void* scratch = pcb_arena_alloc(&arena, rr_scratch_size(blen));
+        workers[k] = (struct sweep_worker){ &job, k, init_procs64_into(procs, bursts, blen), scratch, 0 };
+    }
+    for (int k = 1; k < job.nthreads; k++) {
+        workers[k].started = pthread_create(&threads[k], NULL, sweep_worker_main, &workers[k]) == 0;
+    }
+    sweep_worker_main(&workers[0]);
+
+    for (int k = 1; k < job.nthreads; k++) {
+        // A share whose thread could not be started runs on the caller.
+        if (workers[k].started) {
+            pthread_join(threads[k], NULL);
+        } else {
+            sweep_worker_main(&workers[k]);
+        }
+    }
+
+    pcb_arena_free(&arena);
+    free(workers);
+    free(threads);
+    return job.nrows;
+}
+
+/** One contiguous share of the workloads of a batch_run() */
+struct batch_worker {
+    const int* bursts;
+    const int* offsets;
+    int nwork;
+    int quantum;
+    int* waits;
+    int* totals;
+    int started; /** Whether a host thread is running this share */
+};
+
+static void* batch_worker_main(void* arg) {
+    struct batch_worker* w = arg;
+    if (w->quantum > 0) {
+        rr_batch(w->bursts, w->offsets, w->nwork, w->quantum, w->waits, w->totals);
+    } else {
+        fcfs_batch(w->bursts, w->offsets, w->nwork, w->waits, w->totals);
+    }
+    return NULL;
+}
+
+/**
+ * Simulate 'nwork' independent workloads stored back to back, CSR style:
+ * workload w is bursts[offsets[w]] .. bursts[offsets[w + 1] - 1].
+ *
+ * The workloads are split into contiguous shares, whole multiples of eight
+ * so the SIMD lanes of fcfs_batch() stay full, and each share runs on its
+ * own host thread. The wait of every process goes to the same index of
+ * 'waits' and each workload's total time to totals[w]; nothing is allocated
+ * per workload.
+ *
+ * @param quantum  Round-Robin time quantum, or 0 for FCFS
+ * @param nthreads Number of host threads to use
+ * @return         The number of workloads simulated, 0 if the arguments
+ *                 are invalid, or -1 if memory cannot be allocated.
+ */
+int batch_run(const int* bursts, const int* offsets, int nwork, int quantum,
+              int* waits, int* totals, int nthreads) {
+    if (!bursts || !offsets || nwork <= 0 || quantum < 0 || !waits || !totals) {
+        return 0;
+    }
+
+    int lanes = (nwork + 7) / 8;
+    nthreads = (nthreads < 1) ? 1 : (nthreads > lanes ? lanes : nthreads);
+
+    struct batch_worker* workers = malloc(sizeof(struct batch_worker) * nthreads);
+    pthread_t* threads = malloc(sizeof(pthread_t) * nthreads);
+    if (!workers || !threads) {
+        free(workers);
+        free(threads);
+        return -1;
+    }
+
+    for (int k = 0; k < nthreads; k++) {
+        int first = (int)((int64_t)lanes * k / nthreads) * 8;
+        int last = (int)((int64_t)lanes * (k + 1) / nthreads) * 8;
+        last = (last > nwork) ? nwork : last;
+        workers[k] = (struct batch_worker){ bursts, offsets + first, last - first, quantum,
+                                            waits, totals + first, 0 };
+    }
+    for (int k = 1; k < nthreads; k++) {
+        workers[k].started = pthread_create(&threads[k], NULL, batch_worker_main, &workers[k]) == 0;
+    }
+    batch_worker_main(&workers[0]);
+
+    for (int k = 1; k < nthreads; k++) {
+        // A share whose thread could not be started runs on the caller.
+        if (workers[k].started) {
+            pthread_join(threads[k], NULL);
+        } else {
+            batch_worker_main(&workers[k]);
+        }
+    }
+
+    free(workers);
+    free(threads);
+    return nwork;
+}
+
+/** One whitespace-aligned chunk of a read_bursts_parallel() file */
+struct parse_worker {
+    const char* text;
+    size_t size;
+    struct burst_parser parser; /** Bursts of this chunk */
+    int status;                 /** burst_parser_feed_whole() result */
+    int started;                /** Whether a host thread is running this share */
+};
+
+static void* parse_worker_main(void* arg) {
+    struct parse_worker* w = arg;
+    w->status = burst_parser_feed_whole(&w->parser, w->text, w->size);
+    return NULL;
+}
+
+/**
+ * Read a text workload file like read_bursts_path(), parsing it on
+ * 'nthreads' host threads.
+ *
+ * The file is mapped and cut into 'nthreads' chunks of roughly equal size,
+ * each boundary moved just past the next whitespace byte so no token is
+ * split, so a workload written on a single line is parallel too. A chunk
+ * left without a token (inside a very long one) simply adds no bursts.
+ * Every chunk is parsed and validated by burst_parser_feed_whole() into its
+ * own array, then the arrays are stitched together in file order. Inputs
+ * that cannot be mapped (standard input, pipes) and compressed streams are
+ * read sequentially instead.
+ *
+ * @return The number of bursts read, -1 if reading or allocation fails, or
+ *         PARTA_IO_INVALID if the file holds an invalid token.
+ */
+int read_bursts_parallel(const char* path, int nthreads, int** bursts) {
+    if (!path || !bursts) {
+        return -1;
+    }
+    if (nthreads <= 1 || strcmp(path, "-") == 0) {
+        return read_bursts_path(path, bursts);
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size < 8) {
+        // Read a pipe or FIFO through the descriptor already open, since
+        // reopening it could lose what was written in between.
+        int status = read_bursts_fd(fd, bursts);
+        close(fd);
+        return status;
+    }
+    size_t size = (size_t)st.st_size;
+    char* text = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (text == MAP_FAILED) {
+        return read_bursts_path(path, bursts);
+    }
+    if (memcmp(text, VZ_MAGIC, 8) == 0) {
+        munmap(text, size);
+        return read_bursts_path(path, bursts);
+    }
+    madvise(text, size, MADV_SEQUENTIAL);
+
+    struct parse_worker* workers = calloc((size_t)nthreads, sizeof(struct parse_worker));
+    pthread_t* threads = malloc(sizeof(pthread_t) * nthreads);
+    if (!workers || !threads) {
+        free(workers);
+        free(threads);
+        munmap(text, size);
+        return -1;
+    }
+
+    size_t start = 0;
+    for (int k = 0; k < nthreads; k++) {
+        size_t stop = (k == nthreads - 1) ? size : (size_t)((uint64_t)size * (k + 1) / nthreads);
+        stop = (stop < start) ? start : stop;
+        while (stop > start && stop < size && !burst_is_space(text[stop - 1])) {
+            stop++;
+        }
+        workers[k].text = text + start;
+        workers[k].size = stop - start;
+        burst_parser_init(&workers[k].parser);
+        start = stop;
+    }
+    for (int k = 1; k < nthreads; k++) {
+        workers[k].started = pthread_create(&threads[k], NULL, parse_worker_main, &workers[k]) == 0;
+    }
+    parse_worker_main(&workers[0]);
+
+    int status = 0;
+    int64_t total = 0;
+    for (int k = 0; k < nthreads; k++) {
+        // A share whose thread could not be started runs on the caller.
+        if (k > 0 && workers[k].started) {
+            pthread_join(threads[k], NULL);
+        } else if (k > 0) {
+            parse_worker_main(&workers[k]);
+        }
+        if (workers[k].status != 0 && status == 0) {
+            status = workers[k].status;
+        }
+        total += workers[k].parser.len;
+    }
+    munmap(text, size);
+
+    // The first chunk's array grows to hold the others, in order.
+    int* out = NULL;
+    if (status == 0 && total > INT_MAX) {
+        status = -1;
+    }
+    if (status == 0 && total > 0) {
+        out = realloc(workers[0].parser.bursts, sizeof(int) * (size_t)total);
+        if (out) {
+            workers[0].parser.bursts = NULL;
+            int len = workers[0].parser.len;
+            for (int k = 1; k < nthreads; k++) {
+                if (workers[k].parser.len == 0) {
+                    continue; // its bursts array was never allocated
+                }
+                memcpy(out + len, workers[k].parser.bursts, sizeof(int) * workers[k].parser.len);
+                len += workers[k].parser.len;
+            }
+        } else {
+            status = -1;
+        }
+    }
+
+    for (int k = 0; k < nthreads; k++) {
+        burst_parser_free(&workers[k].parser);
+    }
+    free(workers);
+    free(threads);
+
+    if (status != 0) {
+        free(out);
+        return status;
+    }
+    *bursts = out;
+    return (int)total;
+}
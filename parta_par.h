@@ -0,0 +1,29 @@
+#pragma once
+
+#include "parta.h"
+
+/** Per-CPU results of smp_run() */
+struct smp_cpu_stats {
+    int64_t busy;   /** Time units this CPU spent running processes */
+    int dispatched; /** Number of slices this CPU ran */
+    int stolen;     /** Number of processes this CPU took from other queues */
+};
+
+/** One row of rr_sweep(): the outcome of Round-Robin with one quantum */
+struct sweep_row {
+    int quantum;           /** Time quantum used */
+    double avg_wait;       /** Average wait per process */
+    double avg_turnaround; /** Average wait + burst per process */
+    int64_t total_time;    /** Time at which the last process completes */
+};
+
+/** Number of simulated CPUs that share a domain in smp_run() */
+#define SMP_DOMAIN_CPUS 8
+
+int64_t smp_run(struct pcb* procs, int plen, int ncpu, int quantum, int nthreads,
+                struct smp_cpu_stats* stats);
+int rr_sweep(const int* bursts, int blen, int qlo, int qhi, int qstep, int nthreads,
+             struct sweep_row* rows);
+int batch_run(const int* bursts, const int* offsets, int nwork, int quantum,
+              int* waits, int* totals, int nthreads);
+int read_bursts_parallel(const char* path, int nthreads, int** bursts);
@@ -0,0 +1,122 @@
+#include "parta_stats.h"
+#include <string.h>
+
+/** Empty a histogram. */
+void histogram_init(struct histogram* hist) {
+    memset(hist, 0, sizeof(*hist));
+    hist->min = INT64_MAX;
+    hist->max = INT64_MIN;
+}
+
+/** Index of the bucket holding 'value' (>= 0). */
+static int histogram_index(uint64_t value) {
+    if (value < HIST_SUB_COUNT) {
+        return (int)value;
+    }
+    int shift = 63 - __builtin_clzll(value) - (HIST_SUB_BITS - 1);
+    int mantissa = (int)(value >> shift); // in [HIST_SUB_COUNT / 2, HIST_SUB_COUNT)
+    return HIST_SUB_COUNT + (shift - 1) * (HIST_SUB_COUNT / 2) + (mantissa - HIST_SUB_COUNT / 2);
+}
+
+/** Largest value that falls in bucket 'index'. */
+static int64_t histogram_bucket_max(int index) {
+    if (index < HIST_SUB_COUNT) {
+        return index;
+    }
+    int shift = (index - HIST_SUB_COUNT) / (HIST_SUB_COUNT / 2) + 1;
+    uint64_t mantissa = (uint64_t)((index - HIST_SUB_COUNT) % (HIST_SUB_COUNT / 2) + HIST_SUB_COUNT / 2);
+    return (int64_t)(((mantissa + 1) << shift) - 1);
+}
+
+/** Add one value; negative values are counted as 0. */
+void histogram_add(struct histogram* hist, int64_t value) {
+    value = (value < 0) ? 0 : value;
+
+    hist->count++;
+    hist->sum_lo += (uint64_t)value;
+    hist->sum_hi += (hist->sum_lo < (uint64_t)value);
+    hist->min = (value < hist->min) ? value : hist->min;
+    hist->max = (value > hist->max) ? value : hist->max;
+    hist->buckets[histogram_index((uint64_t)value)]++;
+}
+
+/** Add every value of 'src' to 'dst', as if they had been added one by one. */
+void histogram_merge(struct histogram* dst, const struct histogram* src) {
+    dst->count += src->count;
+    dst->sum_lo += src->sum_lo;
+    dst->sum_hi += src->sum_hi + (dst->sum_lo < src->sum_lo);
+    dst->min = (src->min < dst->min) ? src->min : dst->min;
+    dst->max = (src->max > dst->max) ? src->max : dst->max;
+    for (int b = 0; b < HIST_BUCKETS; b++) {
+        dst->buckets[b] += src->buckets[b];
+    }
+}
+
+/** Exact mean of the values (rounded only when converted), or 0 if empty. */
+double histogram_mean(const struct histogram* hist) {
+    if (hist->count == 0) {
+        return 0.0;
+    }
+    long double sum = (long double)hist->sum_hi * 18446744073709551616.0L + (long double)hist->sum_lo;
+    return (double)(sum / (long double)hist->count);
+}
+
+/**
+ * Value below or at which 'percent' percent of the values lie, e.g. 99.9
+ * for p999. Exact below HIST_SUB_COUNT; above, the upper end of the bucket
+ * holding that rank, so never below the true value and never above the
+ * maximum.
+ *
+ * @return The percentile, or 0 if the histogram is empty.
+ */
+int64_t histogram_percentile(const struct histogram* hist, double percent) {
+    if (hist->count == 0) {
+        return 0;
+    }
+    if (percent <= 0.0) {
+        return hist->min;
+    }
+
+    double wanted = percent / 100.0 * (double)hist->count;
+    uint64_t rank = (wanted >= (double)hist->count) ? hist->count : (uint64_t)wanted;
+    rank += ((double)rank < wanted || rank == 0);
+
+    uint64_t seen = 0;
+    for (int b = histogram_index((uint64_t)hist->min); b < HIST_BUCKETS; b++) {
+        seen += hist->buckets[b];
+        if (seen >= rank) {
+            int64_t value = histogram_bucket_max(b);
+            return (value < hist->max) ? value : hist->max;
+        }
+    }
+    return hist->max;
+}
+
+/**
+ * Feed the outcome of a run of wide-counter PCBs, all arrived at time 0, to
+ * a wait and a turnaround histogram in one pass, with the same conventions
+ * as write_results(): a process with no burst to run reports 0 for both.
+ *
+ * This is a post-run summary: the schedulers do not record completions as
+ * they happen. Their lazy accounting only settles a wait when its process
+ * completes, so reading the finished PCBs gives the same values, and the
+ * engines stay free of per-completion hooks.
+ *
+ * @param bursts The bursts the PCBs were built from.
+ */
+void procs64_stats(const struct pcb64* procs, const int* bursts, int plen,
+                   struct histogram* wait, struct histogram* turnaround) {
+    if (!procs || !bursts) {
+        return;
+    }
+
+    for (int i = 0; i < plen; i++) {
+        int64_t w = (bursts[i] > 0) ? procs[i].wait : 0;
+        if (wait) {
+            histogram_add(wait, w);
+        }
+        if (turnaround) {
+            histogram_add(turnaround, (bursts[i] > 0) ? w + bursts[i] : 0);
+        }
+    }
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "parta.h"
+
+/** Each power-of-two range of a histogram is split into 2^(HIST_SUB_BITS - 1) buckets */
+#define HIST_SUB_BITS 8
+
+/** Values below this are counted exactly, one bucket each */
+#define HIST_SUB_COUNT (1 << HIST_SUB_BITS)
+
+/** Number of buckets needed to cover every non-negative int64_t */
+#define HIST_BUCKETS (HIST_SUB_COUNT + (63 - HIST_SUB_BITS) * (HIST_SUB_COUNT / 2))
+
+/**
+ * HDR-style log-bucketed histogram of non-negative values. Values below
+ * HIST_SUB_COUNT are counted exactly; above that every power-of-two range
+ * has HIST_SUB_COUNT / 2 equal buckets, so a value is recovered to within
+ * 1 / (HIST_SUB_COUNT / 2) of itself. Memory is fixed, inserting is O(1), and
+ * the count, sum, minimum and maximum are exact.
+ */
+struct histogram {
+    uint64_t count;                 /** Number of values added */
+    uint64_t sum_lo;                /** Low 64 bits of the sum of the values */
+    uint64_t sum_hi;                /** High 64 bits of the sum of the values */
+    int64_t min;                    /** Smallest value added */
+    int64_t max;                    /** Largest value added */
+    uint64_t buckets[HIST_BUCKETS]; /** Number of values in each bucket */
+};
+
+void histogram_init(struct histogram* hist);
+void histogram_add(struct histogram* hist, int64_t value);
+void histogram_merge(struct histogram* dst, const struct histogram* src);
+double histogram_mean(const struct histogram* hist);
+int64_t histogram_percentile(const struct histogram* hist, double percent);
+
+void procs64_stats(const struct pcb64* procs, const int* bursts, int plen,
+                   struct histogram* wait, struct histogram* turnaround);
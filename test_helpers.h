@@ -0,0 +1,54 @@
+#pragma once
+
+#include "parta.h"
+#include <stdlib.h> // For malloc/free, rand
+
+/**
+ * Random burst for randomized tests: 0 (an already finished process) one
+ * time in 'done_one_in', otherwise 1 to 'max_burst'.
+ */
+static int random_burst(int max_burst, int done_one_in) {
+    return (rand() % done_one_in == 0) ? 0 : 1 + rand() % max_burst;
+}
+
+/**
+ * Allocate 'plen' PCBs with pid = index, a random_burst() and an earlier
+ * wait of 0 to 3, so a run is checked on finished and already waiting
+ * processes too. Seed with srand() first for a reproducible workload.
+ *
+ * @return The PCBs, or NULL if allocation fails.
+ */
+static struct pcb* random_workload(int plen, int max_burst, int done_one_in) {
+    struct pcb* procs = malloc(sizeof(struct pcb) * plen);
+    if (!procs) {
+        return NULL;
+    }
+
+    for (int i = 0; i < plen; i++) {
+        int burst = random_burst(max_burst, done_one_in);
+        procs[i] = (struct pcb){ i, burst, rand() % 4 };
+    }
+    return procs;
+}
+
+/**
+ * Allocate a copy of 'plen' PCBs, or return NULL if 'procs' is NULL (an
+ * earlier failed allocation) or allocation fails.
+ */
+static struct pcb* copy_procs(const struct pcb* procs, int plen) {
+    if (!procs) {
+        return NULL;
+    }
+    struct pcb* copy = malloc(sizeof(struct pcb) * plen);
+    for (int i = 0; copy && i < plen; i++) {
+        copy[i] = procs[i];
+    }
+    return copy;
+}
+
+/** Free a trial's reference PCBs and its PCBs, leaving *procs NULL for tearDown(). */
+static void free_workload(struct pcb* ref, struct pcb** procs) {
+    free(ref);
+    free(*procs);
+    *procs = NULL;
+}
@@ -0,0 +1,92 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_par.h"
+#include <stdlib.h> // For malloc/free
+
+void setUp(void) {
+    // Code to execute at test start up (currently empty)
+}
+void tearDown(void) {
+    // Code to execute at test conclusion (currently empty)
+}
+void test_fcfs_batch582(void) {
+    // When: workloads {5, 8, 2}, {} and {4, 0, 3}
+    int bursts[] = {5, 8, 2, 4, 0, 3};
+    int offsets[] = {0, 3, 3, 6};
+    int waits[6], totals[3];
+    fcfs_batch(bursts, offsets, 3, waits, totals);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){0, 5, 13, 0, 0, 4}), waits, 6);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){15, 0, 7}), totals, 3);
+}
+void test_rr_batch582(void) {
+    // When
+    int bursts[] = {5, 8, 2, 4, 0, 3};
+    int offsets[] = {0, 3, 3, 6};
+    int waits[6], totals[3];
+    rr_batch(bursts, offsets, 3, 4, waits, totals);
+
+    // Then: Gantt chart for quantum 4 is P0 P1 P2 P0 P1 / P3 P5
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){6, 7, 8, 0, 0, 4}), waits, 6);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){15, 0, 7}), totals, 3);
+}
+void test_batch_invalid(void) {
+    int waits[1], totals[1];
+    TEST_ASSERT_EQUAL_INT(0, batch_run(NULL, (int[]){0, 1}, 1, 0, waits, totals, 1));
+    TEST_ASSERT_EQUAL_INT(0, batch_run((int[]){5}, (int[]){0, 1}, 0, 0, waits, totals, 1));
+    TEST_ASSERT_EQUAL_INT(0, batch_run((int[]){5}, (int[]){0, 1}, 1, -1, waits, totals, 1));
+}
+void test_batch_matches_single_runs(void) {
+    srand(3400);
+    int nwork = 1000;
+    int* offsets = malloc(sizeof(int) * (nwork + 1));
+    int* bursts = malloc(sizeof(int) * nwork * 40);
+    int* waits = malloc(sizeof(int) * nwork * 40);
+    int* totals = malloc(sizeof(int) * nwork);
+    TEST_ASSERT_NOT_NULL(offsets);
+    TEST_ASSERT_NOT_NULL(bursts);
+    TEST_ASSERT_NOT_NULL(waits);
+    TEST_ASSERT_NOT_NULL(totals);
+    offsets[0] = 0;
+    for (int w = 0; w < nwork; w++) {
+        int len = rand() % 40;
+        for (int i = offsets[w]; i < offsets[w] + len; i++) {
+            bursts[i] = rand() % 60 - 5;
+        }
+        offsets[w + 1] = offsets[w] + len;
+    }
+
+    for (int quantum = 0; quantum <= 7; quantum += (quantum ? 3 : 1)) {
+        TEST_ASSERT_EQUAL_INT(nwork, batch_run(bursts, offsets, nwork, quantum, waits, totals, 3));
+        for (int w = 0; w < nwork; w++) {
+            int len = offsets[w + 1] - offsets[w];
+            struct pcb* procs = init_procs(bursts + offsets[w], len);
+            int total_time = 0;
+            if (len > 0) {
+                TEST_ASSERT_NOT_NULL(procs);
+                total_time = (quantum > 0) ? rr_run(procs, len, quantum) : fcfs_run(procs, len);
+            }
+            TEST_ASSERT_EQUAL_INT(total_time, totals[w]);
+            for (int i = 0; i < len; i++) {
+                TEST_ASSERT_EQUAL_INT(procs[i].wait, waits[offsets[w] + i]);
+            }
+            free(procs);
+        }
+    }
+    free(offsets);
+    free(bursts);
+    free(waits);
+    free(totals);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_fcfs_batch582);
+    RUN_TEST(test_rr_batch582);
+    RUN_TEST(test_batch_invalid);
+    RUN_TEST(test_batch_matches_single_runs);
+
+    return UNITY_END();
+}
@@ -0,0 +1,104 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include "test_helpers.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+void test_cfs_weighted(void) {
+    // When: P0 has twice P1's weight
+    procs = init_procs((int[]){6, 6}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = cfs_run(procs, 2, (int[]){2048, 1024}, 2);
+
+    // Then: P0 0-2, P1 2-4, P0 4-6, P0 6-8, P1 8-12
+    TEST_ASSERT_EQUAL_INT(12, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(6, procs[1].wait);
+}
+void test_cfs_equal_weights_is_rr(void) {
+    srand(3400);
+    for (int trial = 0; trial < 200; trial++) {
+        int plen = 1 + rand() % 40;
+        int granularity = 1 + rand() % 8;
+        struct pcb* ref = random_workload(plen, 30, 5);
+        procs = copy_procs(ref, plen);
+        TEST_ASSERT_NOT_NULL(ref);
+        TEST_ASSERT_NOT_NULL(procs);
+
+        TEST_ASSERT_EQUAL_INT(rr_run(ref, plen, granularity), cfs_run(procs, plen, NULL, granularity));
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(ref[i].burst_left, procs[i].burst_left);
+            TEST_ASSERT_EQUAL_INT(ref[i].wait, procs[i].wait);
+        }
+        free_workload(ref, &procs);
+    }
+}
+void test_cfs_matches_linear_pick(void) {
+    srand(3400);
+    for (int trial = 0; trial < 100; trial++) {
+        int plen = 1 + rand() % 150;
+        int granularity = 1 + rand() % 5;
+        int* weights = malloc(sizeof(int) * plen);
+        uint64_t* vruntime = calloc(plen, sizeof(uint64_t));
+        struct pcb* ref = malloc(sizeof(struct pcb) * plen);
+        procs = malloc(sizeof(struct pcb) * plen);
+        TEST_ASSERT_NOT_NULL(weights);
+        TEST_ASSERT_NOT_NULL(vruntime);
+        TEST_ASSERT_NOT_NULL(ref);
+        TEST_ASSERT_NOT_NULL(procs);
+        for (int i = 0; i < plen; i++) {
+            weights[i] = 1 + rand() % 3000;
+            ref[i] = (struct pcb){ i, random_burst(40, 5), 0 };
+            procs[i] = ref[i];
+        }
+
+        // Reference: scan for the lowest (vruntime, index) on every pick.
+        int expected = 0;
+        while (1) {
+            int best = -1;
+            for (int i = 0; i < plen; i++) {
+                if (ref[i].burst_left > 0 && (best == -1 || vruntime[i] < vruntime[best])) {
+                    best = i;
+                }
+            }
+            if (best == -1) {
+                break;
+            }
+            int used = ref[best].burst_left < granularity ? ref[best].burst_left : granularity;
+            run_proc(ref, plen, best, used);
+            expected += used;
+            vruntime[best] += ((uint64_t)used * CFS_NICE0_WEIGHT << 10) / weights[best];
+        }
+
+        TEST_ASSERT_EQUAL_INT(expected, cfs_run(procs, plen, weights, granularity));
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(ref[i].burst_left, procs[i].burst_left);
+            TEST_ASSERT_EQUAL_INT(ref[i].wait, procs[i].wait);
+        }
+        free(weights);
+        free(vruntime);
+        free_workload(ref, &procs);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_cfs_weighted);
+    RUN_TEST(test_cfs_equal_weights_is_rr);
+    RUN_TEST(test_cfs_matches_linear_pick);
+
+    return UNITY_END();
+}
@@ -0,0 +1,70 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include "test_helpers.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+void test_drr_weighted(void) {
+    // When: P0 gets twice P1's quantum
+    procs = init_procs((int[]){6, 6}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = drr_run(procs, 2, (int[]){4, 2});
+
+    // Then: P0 0-4, P1 4-6, P0 6-8, P1 8-10, P1 10-12
+    TEST_ASSERT_EQUAL_INT(12, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(6, procs[1].wait);
+}
+void test_drr_invalid(void) {
+    procs = init_procs((int[]){6, 6}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT(0, drr_run(procs, 2, NULL));
+    TEST_ASSERT_EQUAL_INT(0, drr_run(procs, 2, (int[]){4, 0}));
+    TEST_ASSERT_EQUAL_INT(6, procs[0].burst_left);
+}
+void test_drr_equal_quanta_is_rr(void) {
+    srand(3400);
+    for (int trial = 0; trial < 200; trial++) {
+        int plen = 1 + rand() % 40;
+        int quantum = 1 + rand() % 8;
+        int* quanta = malloc(sizeof(int) * plen);
+        struct pcb* ref = random_workload(plen, 30, 5);
+        procs = copy_procs(ref, plen);
+        TEST_ASSERT_NOT_NULL(quanta);
+        TEST_ASSERT_NOT_NULL(ref);
+        TEST_ASSERT_NOT_NULL(procs);
+        for (int i = 0; i < plen; i++) {
+            quanta[i] = quantum;
+        }
+
+        TEST_ASSERT_EQUAL_INT(rr_run(ref, plen, quantum), drr_run(procs, plen, quanta));
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(ref[i].burst_left, procs[i].burst_left);
+            TEST_ASSERT_EQUAL_INT(ref[i].wait, procs[i].wait);
+        }
+        free(quanta);
+        free_workload(ref, &procs);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_drr_weighted);
+    RUN_TEST(test_drr_invalid);
+    RUN_TEST(test_drr_equal_quanta_is_rr);
+
+    return UNITY_END();
+}
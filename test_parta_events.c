@@ -0,0 +1,99 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include "test_helpers.h"
+#include <stdlib.h> // For malloc/free
+
+static struct apcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+void test_ev_fcfs_idle_gap(void) {
+    // When: P1 arrives long after P0 is done
+    procs = init_aprocs((int[]){3, 2}, (int[]){0, 10}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = ev_fcfs_run(procs, 2);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(12, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+}
+void test_ev_fcfs_arrival_order(void) {
+    // When: listed out of arrival order
+    procs = init_aprocs((int[]){4, 3, 2}, (int[]){5, 0, 1}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = ev_fcfs_run(procs, 3);
+
+    // Then: P1 0-3, P2 3-5, P0 5-9
+    TEST_ASSERT_EQUAL_INT(9, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(2, procs[2].wait);
+}
+void test_ev_rr_tq2(void) {
+    // When: P1 arrives while P0 runs
+    procs = init_aprocs((int[]){5, 3}, (int[]){0, 2}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = ev_rr_run(procs, 2, 2);
+
+    // Then: P0 0-2, P1 2-4, P0 4-6, P1 6-7, P0 7-8
+    TEST_ASSERT_EQUAL_INT(8, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(3, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(2, procs[1].wait);
+}
+void test_ev_matches_time_zero_schedulers(void) {
+    srand(3400);
+    for (int trial = 0; trial < 200; trial++) {
+        int plen = 1 + rand() % 40;
+        int quantum = 1 + rand() % 8;
+        int* bursts = malloc(sizeof(int) * plen);
+        TEST_ASSERT_NOT_NULL(bursts);
+        for (int i = 0; i < plen; i++) {
+            bursts[i] = random_burst(30, 6);
+        }
+        struct pcb* ref_fcfs = init_procs(bursts, plen);
+        struct pcb* ref_rr = init_procs(bursts, plen);
+        struct apcb* rr = init_aprocs(bursts, NULL, plen);
+        procs = init_aprocs(bursts, NULL, plen);
+        TEST_ASSERT_NOT_NULL(ref_fcfs);
+        TEST_ASSERT_NOT_NULL(ref_rr);
+        TEST_ASSERT_NOT_NULL(rr);
+        TEST_ASSERT_NOT_NULL(procs);
+
+        TEST_ASSERT_EQUAL_INT(fcfs_run(ref_fcfs, plen), ev_fcfs_run(procs, plen));
+        TEST_ASSERT_EQUAL_INT(rr_run(ref_rr, plen, quantum), ev_rr_run(rr, plen, quantum));
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(ref_fcfs[i].wait, procs[i].wait);
+            TEST_ASSERT_EQUAL_INT(ref_rr[i].wait, rr[i].wait);
+            TEST_ASSERT_EQUAL_INT(ref_rr[i].burst_left, rr[i].burst_left);
+        }
+        free(bursts);
+        free(ref_fcfs);
+        free(ref_rr);
+        free(rr);
+        free(procs);
+        procs = NULL;
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_ev_fcfs_idle_gap);
+    RUN_TEST(test_ev_fcfs_arrival_order);
+    RUN_TEST(test_ev_rr_tq2);
+    RUN_TEST(test_ev_matches_time_zero_schedulers);
+
+    return UNITY_END();
+}
@@ -1,5 +1,6 @@
 #include "unity.h"  // For Unity Unit Tests
 #include "parta.h"
+#include "test_helpers.h"
 #include <stdlib.h> // For malloc/free
 
 static struct pcb* procs = NULL;
@@ -59,6 +60,42 @@ void test_fcfs582(void) {
     // Freed in tearDown above
 }
 
+void test_fcfs_matches_run_proc(void) {
+    srand(3400);
+    for (int trial = 0; trial < 200; trial++) {
+        // Large enough to exercise the vector scan and its scalar tail.
+        int plen = 1 + rand() % 300;
+        struct pcb* ref = random_workload(plen, 50, 5);
+        TEST_ASSERT_NOT_NULL(ref);
+        for (int i = 0; i < plen; i++) {
+            // Finished (0 or negative) processes must be skipped untouched.
+            if (ref[i].burst_left == 0) {
+                ref[i].burst_left = -(rand() % 3);
+            }
+        }
+        procs = copy_procs(ref, plen);
+        TEST_ASSERT_NOT_NULL(procs);
+
+        int expected = 0;
+        for (int i = 0; i < plen; i++) {
+            if (ref[i].burst_left > 0) {
+                int amount = ref[i].burst_left;
+                run_proc(ref, plen, i, amount);
+                expected += amount;
+            }
+        }
+        int total_time = fcfs_run(procs, plen);
+
+        TEST_ASSERT_EQUAL_INT(expected, total_time);
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(ref[i].pid, procs[i].pid);
+            TEST_ASSERT_EQUAL_INT(ref[i].burst_left, procs[i].burst_left);
+            TEST_ASSERT_EQUAL_INT(ref[i].wait, procs[i].wait);
+        }
+        free_workload(ref, &procs);
+    }
+}
+
 int main(void)
 {
     UNITY_BEGIN();
@@ -66,6 +103,7 @@ int main(void)
     RUN_TEST(test_fcfs5);
     RUN_TEST(test_fcfs58);
     RUN_TEST(test_fcfs582);
+    RUN_TEST(test_fcfs_matches_run_proc);
 
     return UNITY_END();
 }
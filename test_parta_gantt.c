@@ -0,0 +1,135 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <stdlib.h> // For malloc/free
+#include <string.h>
+
+static struct pcb* procs = NULL;
+static struct gantt_trace trace;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+    memset(&trace, 0, sizeof(trace));
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+    gantt_trace_free(&trace);
+}
+
+static void assert_segment(int pid, int start, int length, const struct gantt_segment* segment) {
+    TEST_ASSERT_EQUAL_INT(pid, segment->pid);
+    TEST_ASSERT_EQUAL_INT(start, segment->start);
+    TEST_ASSERT_EQUAL_INT(length, segment->length);
+}
+
+void test_gantt_fcfs58(void) {
+    // When
+    procs = init_procs((int[]){5, 0, 8}, 3);
+    TEST_ASSERT_EQUAL_INT(0, gantt_trace_init(&trace, NULL));
+    int total_time = fcfs_run_traced(procs, 3, &trace);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(13, total_time);
+    TEST_ASSERT_EQUAL_INT(5, procs[2].wait);
+    TEST_ASSERT_EQUAL_INT(2, trace.len);
+    assert_segment(0, 0, 5, &trace.segments[0]);
+    assert_segment(2, 5, 8, &trace.segments[1]);
+}
+void test_gantt_rr58(void) {
+    // When
+    procs = init_procs((int[]){5, 8}, 2);
+    TEST_ASSERT_EQUAL_INT(0, gantt_trace_init(&trace, NULL));
+    int total_time = rr_run_traced(procs, 2, 4, &trace);
+
+    // Then: the README's chart, P0 P1 P0 P1
+    TEST_ASSERT_EQUAL_INT(13, total_time);
+    TEST_ASSERT_EQUAL_INT(0, trace.status);
+    TEST_ASSERT_EQUAL_INT(4, trace.len);
+    assert_segment(0, 0, 4, &trace.segments[0]);
+    assert_segment(1, 4, 4, &trace.segments[1]);
+    assert_segment(0, 8, 1, &trace.segments[2]);
+    assert_segment(1, 9, 4, &trace.segments[3]);
+}
+void test_gantt_rr_merges_lone_process(void) {
+    // When: once P0 finishes, P1 runs 1000 single-unit slices back to back
+    procs = init_procs((int[]){1, 1000}, 2);
+    TEST_ASSERT_EQUAL_INT(0, gantt_trace_init(&trace, NULL));
+    int total_time = rr_run_traced(procs, 2, 1, &trace);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(1001, total_time);
+    TEST_ASSERT_EQUAL_INT(2, trace.len);
+    TEST_ASSERT_EQUAL_INT64(2, trace.count);
+    assert_segment(0, 0, 1, &trace.segments[0]);
+    assert_segment(1, 1, 1000, &trace.segments[1]);
+}
+void test_gantt_stream_matches_memory(void) {
+    srand(3400);
+    int plen = 300;
+    int* bursts = malloc(sizeof(int) * plen);
+    TEST_ASSERT_NOT_NULL(bursts);
+    for (int i = 0; i < plen; i++) {
+        bursts[i] = 1 + rand() % 100;
+    }
+
+    // When: the same schedule recorded in memory and streamed to a file
+    procs = init_procs(bursts, plen);
+    TEST_ASSERT_EQUAL_INT(0, gantt_trace_init(&trace, NULL));
+    int expected_time = rr_run_traced(procs, plen, 3, &trace);
+
+    FILE* file = tmpfile();
+    TEST_ASSERT_NOT_NULL(file);
+    struct gantt_trace streamed;
+    struct pcb* copy = init_procs(bursts, plen);
+    TEST_ASSERT_NOT_NULL(copy);
+    TEST_ASSERT_EQUAL_INT(0, gantt_trace_init(&streamed, file));
+    TEST_ASSERT_EQUAL_INT(expected_time, rr_run_traced(copy, plen, 3, &streamed));
+    TEST_ASSERT_EQUAL_INT(0, gantt_trace_finish(&streamed));
+
+    // Then
+    TEST_ASSERT_TRUE(trace.len > GANTT_STREAM_SEGMENTS);
+    TEST_ASSERT_EQUAL_INT64(trace.len, streamed.count);
+    char magic[8];
+    uint32_t header[2];
+    rewind(file);
+    TEST_ASSERT_EQUAL_INT(1, (int)fread(magic, 8, 1, file));
+    TEST_ASSERT_EQUAL_MEMORY(GANTT_MAGIC, magic, 8);
+    TEST_ASSERT_EQUAL_INT(1, (int)fread(header, sizeof(header), 1, file));
+    TEST_ASSERT_EQUAL_UINT32(sizeof(struct gantt_segment), header[1]);
+    struct gantt_segment* segments = malloc(sizeof(struct gantt_segment) * trace.len);
+    TEST_ASSERT_NOT_NULL(segments);
+    TEST_ASSERT_EQUAL_INT(trace.len, (int)fread(segments, sizeof(struct gantt_segment), trace.len, file));
+    TEST_ASSERT_EQUAL_MEMORY(trace.segments, segments, sizeof(struct gantt_segment) * trace.len);
+
+    // The chart tiles the schedule, and matches the untraced run
+    int time = 0;
+    for (int k = 0; k < trace.len; k++) {
+        TEST_ASSERT_EQUAL_INT(time, trace.segments[k].start);
+        time += trace.segments[k].length;
+    }
+    TEST_ASSERT_EQUAL_INT(expected_time, time);
+    struct pcb* plain = init_procs(bursts, plen);
+    TEST_ASSERT_NOT_NULL(plain);
+    TEST_ASSERT_EQUAL_INT(expected_time, rr_run(plain, plen, 3));
+    TEST_ASSERT_EQUAL_MEMORY(plain, procs, sizeof(struct pcb) * plen);
+
+    fclose(file);
+    gantt_trace_free(&streamed);
+    free(segments);
+    free(copy);
+    free(plain);
+    free(bursts);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_gantt_fcfs58);
+    RUN_TEST(test_gantt_rr58);
+    RUN_TEST(test_gantt_rr_merges_lone_process);
+    RUN_TEST(test_gantt_stream_matches_memory);
+
+    return UNITY_END();
+}
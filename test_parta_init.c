@@ -71,6 +71,47 @@ void test_init582(void) {
     // Freed in tearDown above
 }
 
+void test_init_into_reset(void) {
+    // When
+    struct pcb storage[3];
+    struct pcb* into = init_procs_into(storage, (int[]){5, 8, 2}, 3);
+    (void)fcfs_run(storage, 3);
+    procs_reset(storage, (int[]){5, 8, 2}, 3);
+
+    // Then
+    TEST_ASSERT_EQUAL_PTR(storage, into);
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(i, storage[i].pid);
+        TEST_ASSERT_EQUAL_INT(0, storage[i].wait);
+    }
+    TEST_ASSERT_EQUAL_INT(8, storage[1].burst_left);
+    TEST_ASSERT_NULL(init_procs_into(NULL, (int[]){5}, 1));
+    TEST_ASSERT_NULL(init_procs_into(storage, (int[]){5}, 0));
+}
+void test_arena(void) {
+    struct pcb_arena arena;
+    TEST_ASSERT_EQUAL_INT(0, pcb_arena_init(&arena, 4 * sizeof(struct pcb64)));
+
+    // When: the arena fits two pcb64 arrays of two entries, and no more
+    struct pcb64* first = pcb_arena_alloc(&arena, 2 * sizeof(struct pcb64));
+    struct pcb64* second = pcb_arena_alloc(&arena, 2 * sizeof(struct pcb64));
+    void* full = pcb_arena_alloc(&arena, 1);
+    pcb_arena_reset(&arena);
+    struct pcb64* again = pcb_arena_alloc(&arena, 2 * sizeof(struct pcb64));
+
+    // Then
+    TEST_ASSERT_NOT_NULL(init_procs64_into(first, (int[]){5, 8}, 2));
+    TEST_ASSERT_NOT_NULL(init_procs64_into(second, (int[]){2, 4}, 2));
+    TEST_ASSERT_NULL(full);
+    TEST_ASSERT_EQUAL_PTR(first, again);
+    TEST_ASSERT_EQUAL_INT64(8, first[1].burst_left);
+    TEST_ASSERT_EQUAL_INT64(2, second[0].burst_left);
+    procs64_reset(second, (int[]){7, 9}, 2);
+    TEST_ASSERT_EQUAL_INT64(9, second[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(1, second[1].pid);
+    pcb_arena_free(&arena);
+}
+
 int main(void)
 {
     UNITY_BEGIN();
@@ -78,6 +119,8 @@ int main(void)
     RUN_TEST(test_init5);
     RUN_TEST(test_init8);
     RUN_TEST(test_init58);
+    RUN_TEST(test_init_into_reset);
+    RUN_TEST(test_arena);
 
     return UNITY_END();
 }
@@ -0,0 +1,422 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_io.h"
+#include "parta_par.h"
+#include <stdio.h>  // For tmpfile
+#include <stdlib.h> // For malloc/free
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+static int* bursts = NULL;
+static FILE* file = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    bursts = NULL;
+    file = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(bursts);
+    if (file) {
+        fclose(file);
+    }
+}
+
+/** Write 'text' to a temporary file and return its descriptor, rewound. */
+static int text_fd(const char* text, size_t size) {
+    file = tmpfile();
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL_size_t(size, fwrite(text, 1, size, file));
+    fflush(file);
+    lseek(fileno(file), 0, SEEK_SET);
+    return fileno(file);
+}
+
+void test_read582(void) {
+    // When
+    const char* text = "5 8\n\t2\r\n";
+    int plen = read_bursts_fd(text_fd(text, strlen(text)), &bursts);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(3, plen);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){5, 8, 2}), bursts, 3);
+}
+void test_read_signs_and_limits(void) {
+    // When
+    const char* text = "-3 +4 2147483647 -2147483648 0";
+    int plen = read_bursts_fd(text_fd(text, strlen(text)), &bursts);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(5, plen);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){-3, 4, 2147483647, -2147483647 - 1, 0}), bursts, 5);
+}
+void test_read_empty(void) {
+    TEST_ASSERT_EQUAL_INT(0, read_bursts_fd(text_fd(" \n", 2), &bursts));
+}
+void test_read_invalid(void) {
+    const char* texts[] = { "5 x", "5a", "-", "2147483648", "1-2", "--1" };
+    for (int t = 0; t < 6; t++) {
+        struct burst_parser parser;
+        burst_parser_init(&parser);
+        int status = burst_parser_feed(&parser, texts[t], strlen(texts[t]));
+        if (status == 0) {
+            int* out = NULL;
+            status = burst_parser_finish(&parser, &out);
+            free(out);
+        } else {
+            burst_parser_free(&parser);
+        }
+        TEST_ASSERT_EQUAL_INT(PARTA_IO_INVALID, status);
+    }
+}
+void test_read_across_buffers(void) {
+    // Enough tokens that several straddle the read buffer boundary
+    int count = PARTA_IO_BUFSIZE / 4;
+    char* text = malloc((size_t)count * 8);
+    TEST_ASSERT_NOT_NULL(text);
+    size_t size = 0;
+    srand(3400);
+    int* expected = malloc(sizeof(int) * count);
+    TEST_ASSERT_NOT_NULL(expected);
+    for (int i = 0; i < count; i++) {
+        expected[i] = rand() % 100000;
+        size += (size_t)sprintf(text + size, "%d%c", expected[i], (i % 7) ? ' ' : '\n');
+    }
+
+    // When
+    int plen = read_bursts_fd(text_fd(text, size), &bursts);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(count, plen);
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, bursts, count);
+    free(text);
+    free(expected);
+}
+void test_read_missing_file(void) {
+    TEST_ASSERT_EQUAL_INT(-1, read_bursts_path("/nonexistent/bursts.txt", &bursts));
+}
+
+void test_workload_roundtrip(void) {
+    char path[] = "/tmp/test_parta_io_XXXXXX";
+    int fd = mkstemp(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+    close(fd);
+
+    // When: three processes, so every section needs padding
+    TEST_ASSERT_EQUAL_INT(0, workload_write(path, (int[]){5, 8, 2}, (int[]){0, 1, 2},
+                                            (int[]){1024, 512, 2048}, 3));
+    struct workload wl;
+    int status = workload_open(&wl, path);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(0, status);
+    TEST_ASSERT_EQUAL_INT(3, wl.count);
+    TEST_ASSERT_NULL(wl.bursts64);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(((int32_t[]){5, 8, 2}), wl.bursts, 3);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(((int32_t[]){0, 1, 2}), wl.arrivals, 3);
+    TEST_ASSERT_EQUAL_INT32_ARRAY(((int32_t[]){1024, 512, 2048}), wl.weights, 3);
+    workload_close(&wl);
+    unlink(path);
+}
+void test_workload_burst64(void) {
+    // When: a hand-built file with int64 bursts
+    struct workload_header header;
+    memcpy(header.magic, WORKLOAD_MAGIC, 8);
+    header.version = 1;
+    header.flags = WORKLOAD_BURST64;
+    header.count = 2;
+    int64_t wide[2] = { 5, 10000000000LL };
+    char path[] = "/tmp/test_parta_io_XXXXXX";
+    int fd = mkstemp(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+    TEST_ASSERT_EQUAL_INT(0, write_all(fd, &header, sizeof(header)));
+    TEST_ASSERT_EQUAL_INT(0, write_all(fd, wide, sizeof(wide)));
+    close(fd);
+    struct workload wl;
+    int status = workload_open(&wl, path);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(0, status);
+    TEST_ASSERT_NULL(wl.bursts);
+    TEST_ASSERT_EQUAL_INT64(10000000000LL, wl.bursts64[1]);
+    workload_close(&wl);
+
+    // A truncated file is rejected
+    TEST_ASSERT_EQUAL_INT(0, truncate(path, sizeof(header) + 8));
+    TEST_ASSERT_EQUAL_INT(PARTA_IO_INVALID, workload_open(&wl, path));
+    unlink(path);
+}
+void test_workload_not_binary(void) {
+    char path[] = "/tmp/test_parta_io_XXXXXX";
+    int fd = mkstemp(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+    const char* text = "5 8 2 5 8 2 5 8 2 5 8 2\n";
+    TEST_ASSERT_EQUAL_INT(0, write_all(fd, text, strlen(text)));
+    close(fd);
+
+    struct workload wl;
+    TEST_ASSERT_EQUAL_INT(PARTA_IO_INVALID, workload_open(&wl, path));
+    TEST_ASSERT_EQUAL_INT(-1, workload_open(&wl, "/nonexistent/bursts.wl"));
+    TEST_ASSERT_EQUAL_INT(PARTA_IO_INVALID, workload_open(&wl, "/dev/null"));
+    unlink(path);
+}
+
+void test_vz_roundtrip(void) {
+    // Small bursts (one byte per delta, the SIMD path), large and negative
+    // ones, over several blocks with a partial last block
+    srand(3400);
+    int count = 3 * VZ_BLOCK_VALUES + 123;
+    int* expected = malloc(sizeof(int) * count);
+    TEST_ASSERT_NOT_NULL(expected);
+    for (int i = 0; i < count; i++) {
+        switch ((i / 1000) % 3) {
+        case 0: expected[i] = 10 + rand() % 40; break;
+        case 1: expected[i] = rand() - RAND_MAX / 2; break;
+        default: expected[i] = (i % 2) ? 2147483647 : -2147483647 - 1; break;
+        }
+    }
+    file = tmpfile();
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL_INT(0, vz_write_fd(fileno(file), expected, count));
+    lseek(fileno(file), 0, SEEK_SET);
+
+    // When
+    int plen = read_bursts_fd(fileno(file), &bursts);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(count, plen);
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, bursts, count);
+    free(expected);
+}
+void test_vz_corrupt(void) {
+    int values[20] = { 5, 8, 2 };
+    file = tmpfile();
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL_INT(0, vz_write_fd(fileno(file), values, 20));
+    off_t size = lseek(fileno(file), 0, SEEK_END);
+
+    // When: the last varint is cut off
+    TEST_ASSERT_EQUAL_INT(0, ftruncate(fileno(file), size - 1));
+    lseek(fileno(file), 0, SEEK_SET);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(PARTA_IO_INVALID, read_bursts_fd(fileno(file), &bursts));
+}
+
+/** Parse 'text' with both parsers and check they agree; return the status. */
+static int parse_both(const char* text) {
+    struct burst_parser stream, whole;
+    burst_parser_init(&stream);
+    burst_parser_init(&whole);
+    int* streamed = NULL;
+    int status = burst_parser_feed(&stream, text, strlen(text));
+    status = (status == 0) ? burst_parser_finish(&stream, &streamed) : status;
+    int whole_status = burst_parser_feed_whole(&whole, text, strlen(text));
+
+    TEST_ASSERT_EQUAL_INT(status < 0 ? status : 0, whole_status);
+    if (status > 0) {
+        TEST_ASSERT_EQUAL_INT(status, whole.len);
+        TEST_ASSERT_EQUAL_INT_ARRAY(streamed, whole.bursts, status);
+    }
+    burst_parser_free(&stream);
+    burst_parser_free(&whole);
+    free(streamed);
+    return status;
+}
+
+void test_feed_whole_matches_feed(void) {
+    TEST_ASSERT_EQUAL_INT(3, parse_both("5 8\n2"));
+    TEST_ASSERT_EQUAL_INT(4, parse_both("  00000000000000000012 -7 +123456789 2147483647\n"));
+    TEST_ASSERT_EQUAL_INT(2, parse_both("-2147483648 12345678"));
+    TEST_ASSERT_EQUAL_INT(PARTA_IO_INVALID, parse_both("5 8x 2 3 4 5 6 7 8 9 10 11"));
+    TEST_ASSERT_EQUAL_INT(PARTA_IO_INVALID, parse_both("1 2 3 4 5 6 7 8 9 -"));
+    TEST_ASSERT_EQUAL_INT(PARTA_IO_INVALID, parse_both("2147483648 1 2 3 4 5 6 7 8"));
+    TEST_ASSERT_EQUAL_INT(PARTA_IO_INVALID, parse_both("99999999999999999999 1"));
+
+    // Random tokens, occasionally corrupted
+    srand(3400);
+    char text[512];
+    for (int round = 0; round < 2000; round++) {
+        size_t size = 0;
+        int tokens = rand() % 20;
+        for (int t = 0; t < tokens; t++) {
+            size += (size_t)sprintf(text + size, "%s%d%s", (rand() % 8) ? "" : "-",
+                                    rand() % (1 << (rand() % 31)), (rand() % 5) ? " " : "\n");
+            if (rand() % 100 == 0) {
+                text[rand() % size] = "x+-."[rand() % 4];
+            }
+        }
+        text[size] = '\0';
+        parse_both(text);
+    }
+}
+void test_read_parallel(void) {
+    srand(3400);
+    int count = 200000;
+    char* text = malloc((size_t)count * 8);
+    int* expected = malloc(sizeof(int) * count);
+    TEST_ASSERT_NOT_NULL(text);
+    TEST_ASSERT_NOT_NULL(expected);
+    size_t size = 0;
+    for (int i = 0; i < count; i++) {
+        expected[i] = rand() % 100000;
+        size += (size_t)sprintf(text + size, "%d%c", expected[i], (i % 5) ? ' ' : '\n');
+    }
+    char path[] = "/tmp/test_parta_io_XXXXXX";
+    int fd = mkstemp(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+    TEST_ASSERT_EQUAL_INT(0, write_all(fd, text, size));
+    close(fd);
+
+    for (int nthreads = 1; nthreads <= 7; nthreads += 3) {
+        // When
+        int plen = read_bursts_parallel(path, nthreads, &bursts);
+
+        // Then
+        TEST_ASSERT_EQUAL_INT(count, plen);
+        TEST_ASSERT_EQUAL_INT_ARRAY(expected, bursts, count);
+        free(bursts);
+        bursts = NULL;
+    }
+
+    // An invalid token in any chunk fails the whole read
+    fd = open(path, O_WRONLY);
+    TEST_ASSERT_TRUE(fd >= 0);
+    TEST_ASSERT_EQUAL_INT(1, pwrite(fd, "a", 1, (off_t)(size * 3 / 4)));
+    close(fd);
+    TEST_ASSERT_EQUAL_INT(PARTA_IO_INVALID, read_bursts_parallel(path, 4, &bursts));
+    unlink(path);
+    free(text);
+    free(expected);
+}
+
+void test_read_parallel_single_line(void) {
+    // One line, as the CLI writes bursts, is still cut into several chunks,
+    // and a chunk inside one long token parses no bursts at all.
+    const char* texts[] = { "5 8 2 3 4 5 6 7 8\n", "123456789\n", "7" };
+    int counts[] = { 9, 1, 1 };
+    for (int t = 0; t < 3; t++) {
+        char path[] = "/tmp/test_parta_io_XXXXXX";
+        int fd = mkstemp(path);
+        TEST_ASSERT_TRUE(fd >= 0);
+        TEST_ASSERT_EQUAL_INT(0, write_all(fd, texts[t], strlen(texts[t])));
+        close(fd);
+
+        for (int nthreads = 2; nthreads <= 8; nthreads *= 2) {
+            // When
+            int* expected = NULL;
+            int plen = read_bursts_parallel(path, nthreads, &bursts);
+            TEST_ASSERT_EQUAL_INT(counts[t], read_bursts_path(path, &expected));
+
+            // Then
+            TEST_ASSERT_EQUAL_INT(counts[t], plen);
+            TEST_ASSERT_EQUAL_INT_ARRAY(expected, bursts, plen);
+            free(expected);
+            free(bursts);
+            bursts = NULL;
+        }
+        unlink(path);
+    }
+}
+
+void test_bulk_writer_matches_printf(void) {
+    file = tmpfile();
+    TEST_ASSERT_NOT_NULL(file);
+    struct bulk_writer w;
+    TEST_ASSERT_EQUAL_INT(0, bulk_writer_init(&w, fileno(file)));
+
+    // When: enough lines to flush the buffer several times
+    int64_t edges[] = { 0, 9, 10, 99, 100, -1, -10, INT64_MAX, INT64_MIN };
+    int count = 300000;
+    char* expected = malloc((size_t)count * 48);
+    TEST_ASSERT_NOT_NULL(expected);
+    size_t size = 0;
+    srand(3400);
+    for (int i = 0; i < count; i++) {
+        int64_t value = (i < 9) ? edges[i] : ((int64_t)rand() << (rand() % 33)) - RAND_MAX;
+        bulk_write_str(&w, "P");
+        bulk_write_int(&w, value);
+        bulk_write(&w, "\n", 1);
+        size += (size_t)sprintf(expected + size, "P%lld\n", (long long)value);
+    }
+    TEST_ASSERT_EQUAL_INT(0, bulk_writer_close(&w));
+
+    // Then
+    char* written = malloc(size + 1);
+    TEST_ASSERT_NOT_NULL(written);
+    TEST_ASSERT_EQUAL_INT64((int64_t)size, (int64_t)pread(fileno(file), written, size + 1, 0));
+    TEST_ASSERT_EQUAL_MEMORY(expected, written, size);
+    free(expected);
+    free(written);
+}
+
+void test_write_results(void) {
+    int input[] = { 5, 8, 0, 2 };
+    struct pcb64* procs = init_procs64(input, 4);
+    TEST_ASSERT_NOT_NULL(procs);
+    (void)rr_run64(procs, 4, 2);
+    enum result_format format;
+    TEST_ASSERT_EQUAL_INT(-1, result_format_parse("xml", &format));
+
+    // When
+    char text[512];
+    TEST_ASSERT_EQUAL_INT(0, result_format_parse("csv", &format));
+    file = tmpfile();
+    TEST_ASSERT_NOT_NULL(file);
+    TEST_ASSERT_EQUAL_INT(0, write_results(fileno(file), format, input, procs, 4));
+    ssize_t size = pread(fileno(file), text, sizeof(text) - 1, 0);
+    text[size > 0 ? size : 0] = '\0';
+
+    // Then: Gantt chart for quantum 2 is P0 P1 P3 P0 P1 P0 P1 P1
+    TEST_ASSERT_EQUAL_STRING("pid,burst,wait,turnaround,completion\n"
+                             "0,5,6,11,11\n"
+                             "1,8,7,15,15\n"
+                             "2,0,0,0,0\n"
+                             "3,2,4,6,6\n", text);
+
+    // When
+    TEST_ASSERT_EQUAL_INT(0, result_format_parse("bin", &format));
+    TEST_ASSERT_EQUAL_INT(0, ftruncate(fileno(file), 0));
+    lseek(fileno(file), 0, SEEK_SET);
+    TEST_ASSERT_EQUAL_INT(0, write_results(fileno(file), format, input, procs, 4));
+    struct result_header header;
+    struct result_record records[4];
+    TEST_ASSERT_EQUAL_INT((int)sizeof(header), (int)pread(fileno(file), &header, sizeof(header), 0));
+    TEST_ASSERT_EQUAL_INT((int)sizeof(records),
+                          (int)pread(fileno(file), records, sizeof(records), sizeof(header)));
+
+    // Then
+    TEST_ASSERT_EQUAL_MEMORY(RESULT_MAGIC, header.magic, 8);
+    TEST_ASSERT_EQUAL_UINT64(4, header.count);
+    TEST_ASSERT_EQUAL_INT(1, records[1].pid);
+    TEST_ASSERT_EQUAL_INT(8, records[1].burst);
+    TEST_ASSERT_EQUAL_INT64(7, records[1].wait);
+    TEST_ASSERT_EQUAL_INT64(15, records[1].completion);
+    TEST_ASSERT_EQUAL_INT64(6, records[3].turnaround);
+    free(procs);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_read582);
+    RUN_TEST(test_read_signs_and_limits);
+    RUN_TEST(test_read_empty);
+    RUN_TEST(test_read_invalid);
+    RUN_TEST(test_read_across_buffers);
+    RUN_TEST(test_read_missing_file);
+    RUN_TEST(test_workload_roundtrip);
+    RUN_TEST(test_workload_burst64);
+    RUN_TEST(test_workload_not_binary);
+    RUN_TEST(test_vz_roundtrip);
+    RUN_TEST(test_vz_corrupt);
+    RUN_TEST(test_feed_whole_matches_feed);
+    RUN_TEST(test_read_parallel);
+    RUN_TEST(test_read_parallel_single_line);
+    RUN_TEST(test_bulk_writer_matches_printf);
+    RUN_TEST(test_write_results);
+
+    return UNITY_END();
+}
@@ -0,0 +1,158 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include "test_helpers.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+void test_stride_weighted(void) {
+    // When: P0 holds twice P1's tickets
+    procs = init_procs((int[]){6, 6}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = stride_run(procs, 2, (int[]){2, 1}, 2);
+
+    // Then: P0 0-2, P1 2-4, P0 4-6, P0 6-8, P1 8-12
+    TEST_ASSERT_EQUAL_INT(12, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(6, procs[1].wait);
+}
+void test_stride_large_tickets(void) {
+    // Tickets far above 2^20 keep their 2:1 ratio instead of a zero stride.
+    procs = init_procs((int[]){6, 6}, 2);
+    struct pcb* ref = init_procs((int[]){6, 6}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_NOT_NULL(ref);
+
+    TEST_ASSERT_EQUAL_INT(stride_run(ref, 2, (int[]){2, 1}, 1),
+                          stride_run(procs, 2, (int[]){1 << 30, 1 << 29}, 1));
+    TEST_ASSERT_EQUAL_INT(ref[0].wait, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(ref[1].wait, procs[1].wait);
+    // A zero stride would have run P0 to completion without a wait.
+    TEST_ASSERT_NOT_EQUAL(0, procs[0].wait);
+    free(ref);
+}
+void test_stride_equal_tickets_is_rr(void) {
+    srand(3400);
+    for (int trial = 0; trial < 200; trial++) {
+        int plen = 1 + rand() % 40;
+        int quantum = 1 + rand() % 8;
+        struct pcb* ref = random_workload(plen, 30, 5);
+        procs = copy_procs(ref, plen);
+        TEST_ASSERT_NOT_NULL(ref);
+        TEST_ASSERT_NOT_NULL(procs);
+
+        TEST_ASSERT_EQUAL_INT(rr_run(ref, plen, quantum), stride_run(procs, plen, NULL, quantum));
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(ref[i].burst_left, procs[i].burst_left);
+            TEST_ASSERT_EQUAL_INT(ref[i].wait, procs[i].wait);
+        }
+        free_workload(ref, &procs);
+    }
+}
+void test_lottery_matches_linear_draw(void) {
+    srand(3400);
+    for (int trial = 0; trial < 100; trial++) {
+        int plen = 1 + rand() % 100;
+        int quantum = 1 + rand() % 5;
+        uint64_t seed = (uint64_t)rand();
+        int* tickets = malloc(sizeof(int) * plen);
+        struct pcb* ref = malloc(sizeof(struct pcb) * plen);
+        procs = malloc(sizeof(struct pcb) * plen);
+        TEST_ASSERT_NOT_NULL(tickets);
+        TEST_ASSERT_NOT_NULL(ref);
+        TEST_ASSERT_NOT_NULL(procs);
+        for (int i = 0; i < plen; i++) {
+            tickets[i] = 1 + rand() % 50;
+            ref[i] = (struct pcb){ i, random_burst(30, 5), 0 };
+            procs[i] = ref[i];
+        }
+
+        // Reference: the same draws, resolved by a linear walk over tickets.
+        uint64_t state = seed;
+        int expected = 0;
+        while (1) {
+            uint64_t total = 0;
+            for (int i = 0; i < plen; i++) {
+                total += (ref[i].burst_left > 0) ? tickets[i] : 0;
+            }
+            if (total == 0) {
+                break;
+            }
+            uint64_t draw = sched_rand_below(&state, total);
+            int winner = 0;
+            for (uint64_t seen = 0; winner < plen; winner++) {
+                seen += (ref[winner].burst_left > 0) ? tickets[winner] : 0;
+                if (seen > draw) {
+                    break;
+                }
+            }
+            int used = ref[winner].burst_left < quantum ? ref[winner].burst_left : quantum;
+            run_proc(ref, plen, winner, used);
+            expected += used;
+        }
+
+        TEST_ASSERT_EQUAL_INT(expected, lottery_run(procs, plen, tickets, quantum, seed));
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(ref[i].burst_left, procs[i].burst_left);
+            TEST_ASSERT_EQUAL_INT(ref[i].wait, procs[i].wait);
+        }
+        free(tickets);
+        free_workload(ref, &procs);
+    }
+}
+void test_lottery_reproducible(void) {
+    int bursts[] = { 9, 4, 7, 12, 3 };
+    int tickets[] = { 5, 1, 2, 8, 3 };
+    procs = init_procs(bursts, 5);
+    struct pcb* again = init_procs(bursts, 5);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_NOT_NULL(again);
+
+    TEST_ASSERT_EQUAL_INT(35, lottery_run(procs, 5, tickets, 1, 42));
+    TEST_ASSERT_EQUAL_INT(35, lottery_run(again, 5, tickets, 1, 42));
+    for (int i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL_INT(0, procs[i].burst_left);
+        TEST_ASSERT_EQUAL_INT(again[i].wait, procs[i].wait);
+    }
+    TEST_ASSERT_EQUAL_INT(0, lottery_run(procs, 5, (int[]){ 1, 0, 1, 1, 1 }, 1, 42));
+    free(again);
+}
+
+void test_rand_below_high_word(void) {
+    // The draw is the high word of random * bound, across 64-bit bounds too.
+    for (uint64_t seed = 0; seed < 100; seed++) {
+        uint64_t state = seed, ref = seed;
+        uint64_t r = sched_rand_next(&ref);
+        TEST_ASSERT_EQUAL_UINT64(r >> 32, sched_rand_below(&state, UINT64_C(1) << 32));
+        state = seed;
+        TEST_ASSERT_EQUAL_UINT64(r >> 1, sched_rand_below(&state, UINT64_C(1) << 63));
+        state = seed;
+        TEST_ASSERT_EQUAL_UINT64(r ? r - 1 : 0, sched_rand_below(&state, UINT64_MAX));
+        TEST_ASSERT_EQUAL_UINT64(ref, state);
+        TEST_ASSERT_LESS_THAN_UINT64(7, sched_rand_below(&state, 7));
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_stride_weighted);
+    RUN_TEST(test_stride_large_tickets);
+    RUN_TEST(test_stride_equal_tickets_is_rr);
+    RUN_TEST(test_lottery_matches_linear_draw);
+    RUN_TEST(test_lottery_reproducible);
+    RUN_TEST(test_rand_below_high_word);
+
+    return UNITY_END();
+}
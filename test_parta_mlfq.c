@@ -0,0 +1,67 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include "test_helpers.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+void test_mlfq_two_levels(void) {
+    // When
+    procs = init_procs((int[]){5, 8, 2}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = mlfq_run(procs, 3, 2, (int[]){2, 4});
+
+    // Then: P0 0-2, P1 2-4, P2 4-6 | P0 6-9, P1 9-13, P1 13-15
+    TEST_ASSERT_EQUAL_INT(15, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(4, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(7, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].burst_left);
+    TEST_ASSERT_EQUAL_INT(4, procs[2].wait);
+}
+void test_mlfq_invalid(void) {
+    procs = init_procs((int[]){5, 8}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT(0, mlfq_run(procs, 2, 0, (int[]){2}));
+    TEST_ASSERT_EQUAL_INT(0, mlfq_run(procs, 2, 2, (int[]){2, 0}));
+    TEST_ASSERT_EQUAL_INT(0, mlfq_run(procs, 2, 1, NULL));
+    TEST_ASSERT_EQUAL_INT(5, procs[0].burst_left);
+}
+void test_mlfq_one_level_is_rr(void) {
+    srand(3400);
+    for (int trial = 0; trial < 200; trial++) {
+        int plen = 1 + rand() % 40;
+        int quantum = 1 + rand() % 8;
+        struct pcb* ref = random_workload(plen, 30, 5);
+        procs = copy_procs(ref, plen);
+        TEST_ASSERT_NOT_NULL(ref);
+        TEST_ASSERT_NOT_NULL(procs);
+
+        TEST_ASSERT_EQUAL_INT(rr_run(ref, plen, quantum), mlfq_run(procs, plen, 1, &quantum));
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(ref[i].burst_left, procs[i].burst_left);
+            TEST_ASSERT_EQUAL_INT(ref[i].wait, procs[i].wait);
+        }
+        free_workload(ref, &procs);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_mlfq_two_levels);
+    RUN_TEST(test_mlfq_invalid);
+    RUN_TEST(test_mlfq_one_level_is_rr);
+
+    return UNITY_END();
+}
@@ -1,5 +1,6 @@
 #include "unity.h"  // For Unity Unit Tests
 #include "parta.h"
+#include "test_helpers.h"
 #include <stdlib.h> // For malloc/free
 
 static struct pcb* procs = NULL;
@@ -102,6 +103,44 @@ void test_rr_tq2_582(void) {
     // Freed in tearDown above
 }
 
+// Reference schedule: the original slice-by-slice loop driven by run_proc.
+static int rr_reference(struct pcb* ref, int plen, int quantum) {
+    int time = 0;
+    int current = -1;
+    while ((current = rr_next(current, ref, plen)) != -1) {
+        int amount = ref[current].burst_left < quantum ? ref[current].burst_left : quantum;
+        run_proc(ref, plen, current, amount);
+        time += amount;
+    }
+    return time;
+}
+void test_rr_matches_run_proc(void) {
+    srand(3400);
+    for (int trial = 0; trial < 200; trial++) {
+        int plen = 1 + rand() % 40;
+        int quantum = 1 + rand() % 8;
+        struct pcb* ref = random_workload(plen, 30, 5);
+        struct pcb* scan = copy_procs(ref, plen);
+        procs = copy_procs(ref, plen);
+        TEST_ASSERT_NOT_NULL(ref);
+        TEST_ASSERT_NOT_NULL(scan);
+        TEST_ASSERT_NOT_NULL(procs);
+
+        int expected = rr_reference(ref, plen, quantum);
+        int total_time = rr_run(procs, plen, quantum);
+
+        TEST_ASSERT_EQUAL_INT(expected, total_time);
+        TEST_ASSERT_EQUAL_INT(expected, rr_run_engine(scan, plen, quantum, RR_ENGINE_SCAN));
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(ref[i].burst_left, procs[i].burst_left);
+            TEST_ASSERT_EQUAL_INT(ref[i].wait, procs[i].wait);
+            TEST_ASSERT_EQUAL_INT(ref[i].wait, scan[i].wait);
+        }
+        free(scan);
+        free_workload(ref, &procs);
+    }
+}
+
 int main(void)
 {
     UNITY_BEGIN();
@@ -112,6 +151,7 @@ int main(void)
     RUN_TEST(test_rr_tq2_5);
     RUN_TEST(test_rr_tq2_58);
     RUN_TEST(test_rr_tq2_582);
+    RUN_TEST(test_rr_matches_run_proc);
 
     return UNITY_END();
 }
@@ -99,6 +99,38 @@ void test_rr_next(void) {
 
 }
 
+void test_rr_bitmap_next(void) {
+    srand(3400);
+    for (int trial = 0; trial < 200; trial++) {
+        // Sizes straddle the 64-bit word boundaries of the bitmap.
+        int plen = 1 + rand() % 200;
+        struct pcb* procs = malloc(sizeof(struct pcb) * plen);
+        TEST_ASSERT_NOT_NULL(procs);
+        int density = 1 + rand() % 10;
+        for (int i = 0; i < plen; i++) {
+            procs[i] = (struct pcb){ i, (rand() % density == 0) ? 1 + rand() % 5 : 0, 0 };
+        }
+
+        struct rr_bitmap set;
+        TEST_ASSERT_EQUAL_INT(0, rr_bitmap_init(&set, procs, plen));
+        for (int current = -1; current <= plen; current++) {
+            TEST_ASSERT_EQUAL_INT(rr_next(current, procs, plen), rr_bitmap_next(current, &set));
+        }
+
+        // Finishing a process must drop it from the set.
+        int first = rr_next(-1, procs, plen);
+        if (first != -1) {
+            procs[first].burst_left = 0;
+            rr_bitmap_update(&set, procs, first);
+            for (int current = -1; current < plen; current++) {
+                TEST_ASSERT_EQUAL_INT(rr_next(current, procs, plen), rr_bitmap_next(current, &set));
+            }
+        }
+
+        rr_bitmap_free(&set);
+        free(procs);
+    }
+}
 
 int main(void)
 {
@@ -106,6 +138,7 @@ int main(void)
 
     RUN_TEST(test_rr_all_done);
     RUN_TEST(test_rr_next);
+    RUN_TEST(test_rr_bitmap_next);
 
     return UNITY_END();
 }
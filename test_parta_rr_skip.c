@@ -0,0 +1,109 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include "test_helpers.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+/** Dispatches recorded by the test callback */
+struct dispatch_log {
+    int len;
+    int cap;
+    int* entries; // (index, start, amount) triples
+};
+
+static void record_dispatch(void* ctx, int index, int start, int amount) {
+    struct dispatch_log* log = ctx;
+    if (log->len + 3 > log->cap) {
+        log->cap = log->cap ? log->cap * 2 : 48;
+        log->entries = realloc(log->entries, sizeof(int) * log->cap);
+        TEST_ASSERT_NOT_NULL(log->entries);
+    }
+    log->entries[log->len++] = index;
+    log->entries[log->len++] = start;
+    log->entries[log->len++] = amount;
+}
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+void test_rr_skip_tq4_58(void) {
+    // When
+    procs = init_procs((int[]){5, 8}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    struct dispatch_log log = { 0, 0, NULL };
+    int total_time = rr_run_skip(procs, 2, 4, record_dispatch, &log);
+
+    // Then: the Gantt chart P0 | P1 | P0 | P1 from the README
+    TEST_ASSERT_EQUAL_INT(13, total_time);
+    TEST_ASSERT_EQUAL_INT(4, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(5, procs[1].wait);
+    int expected[] = { 0, 0, 4,  1, 4, 4,  0, 8, 1,  1, 9, 4 };
+    TEST_ASSERT_EQUAL_INT(12, log.len);
+    TEST_ASSERT_EQUAL_INT_ARRAY(expected, log.entries, 12);
+    free(log.entries);
+}
+void test_rr_skip_matches_rr_run(void) {
+    srand(3400);
+    for (int trial = 0; trial < 300; trial++) {
+        int plen = 1 + rand() % 30;
+        int quantum = 1 + rand() % 6;
+        struct pcb* ref = random_workload(plen, 60, 6);
+        struct pcb* traced = copy_procs(ref, plen);
+        procs = copy_procs(ref, plen);
+        TEST_ASSERT_NOT_NULL(ref);
+        TEST_ASSERT_NOT_NULL(traced);
+        TEST_ASSERT_NOT_NULL(procs);
+
+        // Reference dispatch sequence from the rr_next loop.
+        struct dispatch_log expected = { 0, 0, NULL };
+        {
+            struct pcb* copy = copy_procs(ref, plen);
+            TEST_ASSERT_NOT_NULL(copy);
+            int time = 0;
+            int current = -1;
+            while ((current = rr_next(current, copy, plen)) != -1) {
+                int amount = copy[current].burst_left < quantum ? copy[current].burst_left : quantum;
+                record_dispatch(&expected, current, time, amount);
+                run_proc(copy, plen, current, amount);
+                time += amount;
+            }
+            free(copy);
+        }
+
+        int expected_time = rr_run(ref, plen, quantum);
+        TEST_ASSERT_EQUAL_INT(expected_time, rr_run_skip(procs, plen, quantum, NULL, NULL));
+
+        struct dispatch_log log = { 0, 0, NULL };
+        TEST_ASSERT_EQUAL_INT(expected_time, rr_run_skip(traced, plen, quantum, record_dispatch, &log));
+        TEST_ASSERT_EQUAL_INT(expected.len, log.len);
+        if (log.len > 0) {
+            TEST_ASSERT_EQUAL_INT_ARRAY(expected.entries, log.entries, log.len);
+        }
+
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(ref[i].burst_left, procs[i].burst_left);
+            TEST_ASSERT_EQUAL_INT(ref[i].wait, procs[i].wait);
+            TEST_ASSERT_EQUAL_INT(ref[i].wait, traced[i].wait);
+        }
+        free(expected.entries);
+        free(log.entries);
+        free(traced);
+        free_workload(ref, &procs);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_rr_skip_tq4_58);
+    RUN_TEST(test_rr_skip_matches_rr_run);
+
+    return UNITY_END();
+}
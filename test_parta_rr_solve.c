@@ -0,0 +1,78 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include "test_helpers.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+void test_rr_solve_tq4_582(void) {
+    // When
+    procs = init_procs((int[]){5, 8, 2}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = rr_solve(procs, 3, 4);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(15, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(6, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(7, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].burst_left);
+    TEST_ASSERT_EQUAL_INT(8, procs[2].wait);
+
+    // Freed in tearDown above
+}
+void test_rr_solve_tq2_582(void) {
+    // When
+    procs = init_procs((int[]){5, 8, 2}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = rr_solve(procs, 3, 2);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(15, total_time);
+    TEST_ASSERT_EQUAL_INT(6, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(7, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(4, procs[2].wait);
+
+    // Freed in tearDown above
+}
+void test_rr_solve_matches_rr_run(void) {
+    srand(3400);
+    for (int trial = 0; trial < 500; trial++) {
+        int plen = 1 + rand() % 60;
+        int quantum = 1 + rand() % 10;
+        struct pcb* ref = random_workload(plen, 40, 6);
+        procs = copy_procs(ref, plen);
+        TEST_ASSERT_NOT_NULL(ref);
+        TEST_ASSERT_NOT_NULL(procs);
+
+        int expected = rr_run(ref, plen, quantum);
+        int total_time = rr_solve(procs, plen, quantum);
+
+        TEST_ASSERT_EQUAL_INT(expected, total_time);
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(ref[i].burst_left, procs[i].burst_left);
+            TEST_ASSERT_EQUAL_INT(ref[i].wait, procs[i].wait);
+        }
+        free_workload(ref, &procs);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_rr_solve_tq4_582);
+    RUN_TEST(test_rr_solve_tq2_582);
+    RUN_TEST(test_rr_solve_matches_rr_run);
+
+    return UNITY_END();
+}
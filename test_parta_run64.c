@@ -0,0 +1,149 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include "test_helpers.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb64* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+void test_fcfs64_582(void) {
+    // When
+    procs = init_procs64((int[]){5, 8, 2}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    int64_t total_time = fcfs_run64(procs, 3);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT64(15, total_time);
+    TEST_ASSERT_EQUAL_INT64(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT64(5, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT64(13, procs[2].wait);
+    TEST_ASSERT_EQUAL_INT64(18, procs64_sum_wait(procs, 3));
+}
+void test_rr64_tq2_582(void) {
+    // When
+    procs = init_procs64((int[]){5, 8, 2}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    int64_t total_time = rr_run64(procs, 3, 2);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT64(15, total_time);
+    TEST_ASSERT_EQUAL_INT64(6, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT64(7, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT64(4, procs[2].wait);
+    TEST_ASSERT_EQUAL_INT64(17, procs64_sum_wait(procs, 3));
+}
+void test_run64_matches_int(void) {
+    srand(3400);
+    for (int trial = 0; trial < 200; trial++) {
+        int plen = 1 + rand() % 60;
+        int quantum = 1 + rand() % 10;
+        int* bursts = malloc(sizeof(int) * plen);
+        TEST_ASSERT_NOT_NULL(bursts);
+        for (int i = 0; i < plen; i++) {
+            bursts[i] = random_burst(40, 6);
+        }
+        struct pcb* ref_fcfs = init_procs(bursts, plen);
+        struct pcb* ref_rr = init_procs(bursts, plen);
+        struct pcb64* rr = init_procs64(bursts, plen);
+        procs = init_procs64(bursts, plen);
+        TEST_ASSERT_NOT_NULL(ref_fcfs);
+        TEST_ASSERT_NOT_NULL(ref_rr);
+        TEST_ASSERT_NOT_NULL(rr);
+        TEST_ASSERT_NOT_NULL(procs);
+
+        TEST_ASSERT_EQUAL_INT64(fcfs_run(ref_fcfs, plen), fcfs_run64(procs, plen));
+        TEST_ASSERT_EQUAL_INT64(rr_run(ref_rr, plen, quantum), rr_run64(rr, plen, quantum));
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT64(ref_fcfs[i].wait, procs[i].wait);
+            TEST_ASSERT_EQUAL_INT64(ref_rr[i].wait, rr[i].wait);
+            TEST_ASSERT_EQUAL_INT64(ref_rr[i].burst_left, rr[i].burst_left);
+        }
+        free(bursts);
+        free(ref_fcfs);
+        free(ref_rr);
+        free(rr);
+        free(procs);
+        procs = NULL;
+    }
+}
+void test_run64_no_overflow(void) {
+    // 100000 processes of 50000 units: the total and the waits exceed INT_MAX.
+    int plen = 100000;
+    int* bursts = malloc(sizeof(int) * plen);
+    TEST_ASSERT_NOT_NULL(bursts);
+    for (int i = 0; i < plen; i++) {
+        bursts[i] = 50000;
+    }
+    procs = init_procs64(bursts, plen);
+    TEST_ASSERT_NOT_NULL(procs);
+
+    TEST_ASSERT_EQUAL_INT64((int64_t)plen * 50000, fcfs_run64(procs, plen));
+    TEST_ASSERT_EQUAL_INT64((int64_t)(plen - 1) * 50000, procs[plen - 1].wait);
+    // sum of 50000 * i for i in [0, plen)
+    TEST_ASSERT_EQUAL_INT64((int64_t)50000 * plen * (plen - 1) / 2, procs64_sum_wait(procs, plen));
+
+    free(procs);
+    procs = init_procs64(bursts, plen);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT64((int64_t)plen * 50000, rr_run64(procs, plen, 1000));
+    // The last process completes last, at the very end of the schedule.
+    TEST_ASSERT_EQUAL_INT64((int64_t)plen * 50000 - 50000, procs[plen - 1].wait);
+    free(bursts);
+}
+
+void test_run64_scratch_reused(void) {
+    // One scratch block, sized for the longest workload, serves every run.
+    srand(3400);
+    void* scratch = malloc(rr_scratch_size(60));
+    TEST_ASSERT_NOT_NULL(scratch);
+    for (int trial = 0; trial < 200; trial++) {
+        int plen = 1 + rand() % 60;
+        int quantum = 1 + rand() % 10;
+        int* bursts = malloc(sizeof(int) * plen);
+        TEST_ASSERT_NOT_NULL(bursts);
+        for (int i = 0; i < plen; i++) {
+            bursts[i] = random_burst(40, 6);
+        }
+        struct pcb64* ref = init_procs64(bursts, plen);
+        struct pcb64* scan = init_procs64(bursts, plen);
+        procs = init_procs64(bursts, plen);
+        TEST_ASSERT_NOT_NULL(ref);
+        TEST_ASSERT_NOT_NULL(scan);
+        TEST_ASSERT_NOT_NULL(procs);
+
+        int64_t total_time = rr_run64(ref, plen, quantum);
+        TEST_ASSERT_EQUAL_INT64(total_time, rr_run64_scratch(procs, plen, quantum, scratch));
+        // Without scratch it falls back to slice-by-slice simulation.
+        TEST_ASSERT_EQUAL_INT64(total_time, rr_run64_scratch(scan, plen, quantum, NULL));
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT64(ref[i].wait, procs[i].wait);
+            TEST_ASSERT_EQUAL_INT64(ref[i].wait, scan[i].wait);
+        }
+        free(bursts);
+        free(ref);
+        free(scan);
+        free(procs);
+        procs = NULL;
+    }
+    free(scratch);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_fcfs64_582);
+    RUN_TEST(test_rr64_tq2_582);
+    RUN_TEST(test_run64_matches_int);
+    RUN_TEST(test_run64_no_overflow);
+    RUN_TEST(test_run64_scratch_reused);
+
+    return UNITY_END();
+}
@@ -0,0 +1,145 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include "test_helpers.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+static struct apcb* aprocs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+    aprocs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+    free(aprocs);
+}
+void test_sjf582(void) {
+    // When
+    procs = init_procs((int[]){5, 8, 2}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = sjf_run(procs, 3);
+
+    // Then: P2 0-2, P0 2-7, P1 7-15
+    TEST_ASSERT_EQUAL_INT(15, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(7, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].burst_left);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].wait);
+}
+void test_sjf_ties(void) {
+    // When: equal bursts keep their listed order; finished ones are skipped
+    procs = init_procs((int[]){3, 0, 3, 1}, 4);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = sjf_run(procs, 4);
+
+    // Then: P3 0-1, P0 1-4, P2 4-7
+    TEST_ASSERT_EQUAL_INT(7, total_time);
+    TEST_ASSERT_EQUAL_INT(1, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(4, procs[2].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[3].wait);
+}
+void test_srtf_preempt(void) {
+    // When
+    aprocs = init_aprocs((int[]){8, 4, 9, 5}, (int[]){0, 1, 2, 3}, 4);
+    TEST_ASSERT_NOT_NULL(aprocs);
+    int total_time = srtf_run(aprocs, 4);
+
+    // Then: P0 0-1, P1 1-5, P3 5-10, P0 10-17, P2 17-26
+    TEST_ASSERT_EQUAL_INT(26, total_time);
+    TEST_ASSERT_EQUAL_INT(9, aprocs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, aprocs[1].wait);
+    TEST_ASSERT_EQUAL_INT(15, aprocs[2].wait);
+    TEST_ASSERT_EQUAL_INT(2, aprocs[3].wait);
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(0, aprocs[i].burst_left);
+    }
+}
+void test_srtf_matches_unit_steps(void) {
+    srand(3400);
+    for (int trial = 0; trial < 200; trial++) {
+        int plen = 1 + rand() % 30;
+        int* bursts = malloc(sizeof(int) * plen);
+        int* arrivals = malloc(sizeof(int) * plen);
+        TEST_ASSERT_NOT_NULL(bursts);
+        TEST_ASSERT_NOT_NULL(arrivals);
+        for (int i = 0; i < plen; i++) {
+            bursts[i] = random_burst(20, 6);
+            arrivals[i] = rand() % 60;
+        }
+        aprocs = init_aprocs(bursts, arrivals, plen);
+        struct apcb* ref = init_aprocs(bursts, arrivals, plen);
+        TEST_ASSERT_NOT_NULL(aprocs);
+        TEST_ASSERT_NOT_NULL(ref);
+
+        // Reference: one time unit at a time, shortest remaining first.
+        int time = 0, last = 0, left = 0;
+        for (int i = 0; i < plen; i++) {
+            left += ref[i].burst_left > 0;
+        }
+        while (left > 0) {
+            int best = -1;
+            for (int i = 0; i < plen; i++) {
+                if (ref[i].burst_left <= 0 || ref[i].arrival > time) {
+                    continue;
+                }
+                if (best == -1 || ref[i].burst_left < ref[best].burst_left
+                    || (ref[i].burst_left == ref[best].burst_left && ref[i].arrival < ref[best].arrival)) {
+                    best = i;
+                }
+            }
+            for (int i = 0; i < plen; i++) {
+                if (i != best && ref[i].burst_left > 0 && ref[i].arrival <= time) {
+                    ref[i].wait++;
+                }
+            }
+            time++;
+            if (best != -1 && --ref[best].burst_left == 0) {
+                left--;
+                last = time;
+            }
+        }
+
+        TEST_ASSERT_EQUAL_INT(last, srtf_run(aprocs, plen));
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(ref[i].burst_left, aprocs[i].burst_left);
+            TEST_ASSERT_EQUAL_INT(ref[i].wait, aprocs[i].wait);
+        }
+
+        // With every arrival at 0, SRTF never preempts and matches SJF.
+        procs = init_procs(bursts, plen);
+        free(aprocs);
+        aprocs = init_aprocs(bursts, NULL, plen);
+        TEST_ASSERT_NOT_NULL(procs);
+        TEST_ASSERT_NOT_NULL(aprocs);
+        TEST_ASSERT_EQUAL_INT(sjf_run(procs, plen), srtf_run(aprocs, plen));
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(procs[i].wait, aprocs[i].wait);
+        }
+
+        free(bursts);
+        free(arrivals);
+        free(ref);
+        free(procs);
+        free(aprocs);
+        procs = NULL;
+        aprocs = NULL;
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_sjf582);
+    RUN_TEST(test_sjf_ties);
+    RUN_TEST(test_srtf_preempt);
+    RUN_TEST(test_srtf_matches_unit_steps);
+
+    return UNITY_END();
+}
@@ -0,0 +1,120 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_par.h"
+#include "test_helpers.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+void test_smp_two_cpus(void) {
+    // When: CPU0 gets P0 and P2, CPU1 gets P1
+    procs = init_procs((int[]){5, 8, 2}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    struct smp_cpu_stats stats[2];
+    int64_t total_time = smp_run(procs, 3, 2, 0, 1, stats);
+
+    // Then: CPU0 runs P0 0-5, P2 5-7; CPU1 runs P1 0-8
+    TEST_ASSERT_EQUAL_INT64(8, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(5, procs[2].wait);
+    TEST_ASSERT_EQUAL_INT64(7, stats[0].busy);
+    TEST_ASSERT_EQUAL_INT64(8, stats[1].busy);
+    TEST_ASSERT_EQUAL_INT(2, stats[0].dispatched);
+    TEST_ASSERT_EQUAL_INT(1, stats[1].dispatched);
+}
+void test_smp_steal(void) {
+    // When: CPU1 finishes P1 early and steals P2 from CPU0's queue
+    procs = init_procs((int[]){10, 1, 3}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    struct smp_cpu_stats stats[2];
+    int64_t total_time = smp_run(procs, 3, 2, 0, 1, stats);
+
+    // Then: CPU0 runs P0 0-10; CPU1 runs P1 0-1, P2 1-4
+    TEST_ASSERT_EQUAL_INT64(10, total_time);
+    TEST_ASSERT_EQUAL_INT(1, procs[2].wait);
+    TEST_ASSERT_EQUAL_INT(1, stats[1].stolen);
+    TEST_ASSERT_EQUAL_INT(0, stats[0].stolen);
+}
+void test_smp_one_cpu_is_uniprocessor(void) {
+    srand(3400);
+    for (int trial = 0; trial < 100; trial++) {
+        int plen = 1 + rand() % 40;
+        int quantum = rand() % 6; // 0 is FCFS
+        struct pcb* ref = random_workload(plen, 30, 5);
+        procs = copy_procs(ref, plen);
+        TEST_ASSERT_NOT_NULL(ref);
+        TEST_ASSERT_NOT_NULL(procs);
+
+        int expected = quantum ? rr_run(ref, plen, quantum) : fcfs_run(ref, plen);
+        TEST_ASSERT_EQUAL_INT64(expected, smp_run(procs, plen, 1, quantum, 1, NULL));
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(ref[i].burst_left, procs[i].burst_left);
+            TEST_ASSERT_EQUAL_INT(ref[i].wait, procs[i].wait);
+        }
+        free_workload(ref, &procs);
+    }
+}
+void test_smp_threads_do_not_change_result(void) {
+    srand(3400);
+    int plen = 20000, ncpu = 40;
+    int* bursts = malloc(sizeof(int) * plen);
+    TEST_ASSERT_NOT_NULL(bursts);
+    int64_t work = 0;
+    for (int i = 0; i < plen; i++) {
+        // Skewed so that queues drain unevenly and stealing kicks in.
+        bursts[i] = (i % ncpu < 5) ? 50 + rand() % 200 : 1 + rand() % 20;
+        work += bursts[i];
+    }
+    procs = init_procs(bursts, plen);
+    struct pcb* threaded = init_procs(bursts, plen);
+    struct smp_cpu_stats* stats = malloc(sizeof(struct smp_cpu_stats) * ncpu);
+    struct smp_cpu_stats* threaded_stats = malloc(sizeof(struct smp_cpu_stats) * ncpu);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_NOT_NULL(threaded);
+    TEST_ASSERT_NOT_NULL(stats);
+    TEST_ASSERT_NOT_NULL(threaded_stats);
+
+    int64_t total_time = smp_run(procs, plen, ncpu, 4, 1, stats);
+    TEST_ASSERT_EQUAL_INT64(total_time, smp_run(threaded, plen, ncpu, 4, 4, threaded_stats));
+
+    int64_t busy = 0;
+    int stolen = 0;
+    for (int c = 0; c < ncpu; c++) {
+        TEST_ASSERT_EQUAL_INT64(stats[c].busy, threaded_stats[c].busy);
+        TEST_ASSERT_EQUAL_INT(stats[c].stolen, threaded_stats[c].stolen);
+        TEST_ASSERT_TRUE(stats[c].busy <= total_time);
+        busy += stats[c].busy;
+        stolen += stats[c].stolen;
+    }
+    TEST_ASSERT_EQUAL_INT64(work, busy);
+    TEST_ASSERT_TRUE(stolen > 0);
+    for (int i = 0; i < plen; i++) {
+        TEST_ASSERT_EQUAL_INT(0, procs[i].burst_left);
+        TEST_ASSERT_EQUAL_INT(procs[i].wait, threaded[i].wait);
+        TEST_ASSERT_TRUE(procs[i].wait >= 0 && procs[i].wait + bursts[i] <= total_time);
+    }
+    free(bursts);
+    free(threaded);
+    free(stats);
+    free(threaded_stats);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_smp_two_cpus);
+    RUN_TEST(test_smp_steal);
+    RUN_TEST(test_smp_one_cpu_is_uniprocessor);
+    RUN_TEST(test_smp_threads_do_not_change_result);
+
+    return UNITY_END();
+}
@@ -0,0 +1,133 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_stats.h"
+#include <stdlib.h> // For malloc/free
+
+static struct histogram* hist = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    hist = malloc(sizeof(struct histogram));
+    TEST_ASSERT_NOT_NULL(hist);
+    histogram_init(hist);
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(hist);
+}
+
+static int compare_int64(const void* a, const void* b) {
+    int64_t x = *(const int64_t*)a, y = *(const int64_t*)b;
+    return (x > y) - (x < y);
+}
+
+void test_stats_empty(void) {
+    TEST_ASSERT_EQUAL_UINT64(0, hist->count);
+    TEST_ASSERT_EQUAL_FLOAT(0.0, histogram_mean(hist));
+    TEST_ASSERT_EQUAL_INT64(0, histogram_percentile(hist, 50));
+}
+void test_stats_small_values_exact(void) {
+    // When: 1..100, all below HIST_SUB_COUNT
+    for (int v = 100; v >= 1; v--) {
+        histogram_add(hist, v);
+    }
+
+    // Then
+    TEST_ASSERT_EQUAL_FLOAT(50.5, histogram_mean(hist));
+    TEST_ASSERT_EQUAL_INT64(1, histogram_percentile(hist, 0));
+    TEST_ASSERT_EQUAL_INT64(50, histogram_percentile(hist, 50));
+    TEST_ASSERT_EQUAL_INT64(90, histogram_percentile(hist, 90));
+    TEST_ASSERT_EQUAL_INT64(99, histogram_percentile(hist, 99));
+    TEST_ASSERT_EQUAL_INT64(100, histogram_percentile(hist, 99.9));
+    TEST_ASSERT_EQUAL_INT64(100, histogram_percentile(hist, 100));
+}
+void test_stats_rr582(void) {
+    // When
+    int bursts[] = { 5, 8, 2 };
+    struct pcb64* procs = init_procs64(bursts, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    (void)rr_run64(procs, 3, 2);
+    struct histogram* turnaround = malloc(sizeof(struct histogram));
+    TEST_ASSERT_NOT_NULL(turnaround);
+    histogram_init(turnaround);
+    procs64_stats(procs, bursts, 3, hist, turnaround);
+
+    // Then: waits 6, 7, 4 and turnarounds 11, 15, 6
+    TEST_ASSERT_EQUAL_FLOAT(17.0 / 3, histogram_mean(hist));
+    TEST_ASSERT_EQUAL_INT64(6, histogram_percentile(hist, 50));
+    TEST_ASSERT_EQUAL_INT64(7, hist->max);
+    TEST_ASSERT_EQUAL_INT64(4, hist->min);
+    TEST_ASSERT_EQUAL_INT64(11, histogram_percentile(turnaround, 50));
+    TEST_ASSERT_EQUAL_INT64(15, histogram_percentile(turnaround, 99));
+    free(procs);
+    free(turnaround);
+}
+void test_stats_percentile_error_bound(void) {
+    srand(3400);
+    int count = 100000;
+    int64_t* values = malloc(sizeof(int64_t) * count);
+    TEST_ASSERT_NOT_NULL(values);
+    for (int i = 0; i < count; i++) {
+        values[i] = (int64_t)rand() << (rand() % 24);
+        histogram_add(hist, values[i]);
+    }
+    qsort(values, count, sizeof(int64_t), compare_int64);
+
+    double percents[] = { 1, 50, 90, 99, 99.9, 100 };
+    for (int p = 0; p < 6; p++) {
+        // When
+        int64_t exact = values[(int64_t)(percents[p] / 100.0 * count + 0.999999) - 1];
+        int64_t approx = histogram_percentile(hist, percents[p]);
+
+        // Then: never below, and within one bucket above
+        TEST_ASSERT_TRUE(approx >= exact);
+        TEST_ASSERT_TRUE((double)(approx - exact) <= (double)exact / (HIST_SUB_COUNT / 2));
+    }
+    TEST_ASSERT_EQUAL_INT64(values[count - 1], hist->max);
+    free(values);
+}
+void test_stats_exact_mean_past_int64(void) {
+    // When: the sum overflows 64 bits
+    for (int i = 0; i < 4; i++) {
+        histogram_add(hist, INT64_MAX);
+    }
+    histogram_add(hist, -5); // counted as 0
+
+    // Then
+    TEST_ASSERT_EQUAL_UINT64(5, hist->count);
+    TEST_ASSERT_EQUAL_FLOAT(4.0 * (double)INT64_MAX / 5.0, histogram_mean(hist));
+    TEST_ASSERT_EQUAL_INT64(0, histogram_percentile(hist, 20));
+    TEST_ASSERT_EQUAL_INT64(INT64_MAX, histogram_percentile(hist, 50));
+}
+void test_stats_merge(void) {
+    struct histogram* other = malloc(sizeof(struct histogram));
+    TEST_ASSERT_NOT_NULL(other);
+    histogram_init(other);
+
+    // When
+    for (int v = 1; v <= 50; v++) {
+        histogram_add(hist, v);
+        histogram_add(other, v + 50);
+    }
+    histogram_merge(hist, other);
+
+    // Then
+    TEST_ASSERT_EQUAL_UINT64(100, hist->count);
+    TEST_ASSERT_EQUAL_FLOAT(50.5, histogram_mean(hist));
+    TEST_ASSERT_EQUAL_INT64(90, histogram_percentile(hist, 90));
+    TEST_ASSERT_EQUAL_INT64(1, hist->min);
+    free(other);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_stats_empty);
+    RUN_TEST(test_stats_small_values_exact);
+    RUN_TEST(test_stats_rr582);
+    RUN_TEST(test_stats_percentile_error_bound);
+    RUN_TEST(test_stats_exact_mean_past_int64);
+    RUN_TEST(test_stats_merge);
+
+    return UNITY_END();
+}
@@ -0,0 +1,72 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta_par.h"
+#include <stdlib.h> // For malloc/free
+
+void setUp(void) {
+    // Code to execute at test start up (currently empty)
+}
+void tearDown(void) {
+    // Code to execute at test conclusion (currently empty)
+}
+void test_sweep582(void) {
+    // When
+    struct sweep_row rows[4];
+    int nrows = rr_sweep((int[]){5, 8, 2}, 3, 1, 10, 3, 2, rows);
+
+    // Then: quanta 1, 4, 7, 10
+    TEST_ASSERT_EQUAL_INT(4, nrows);
+    TEST_ASSERT_EQUAL_INT(1, rows[0].quantum);
+    TEST_ASSERT_EQUAL_INT(4, rows[1].quantum);
+    TEST_ASSERT_EQUAL_INT(10, rows[3].quantum);
+    TEST_ASSERT_EQUAL_FLOAT(21.0 / 3, rows[1].avg_wait);
+    TEST_ASSERT_EQUAL_FLOAT(36.0 / 3, rows[1].avg_turnaround);
+    for (int r = 0; r < nrows; r++) {
+        TEST_ASSERT_EQUAL_INT64(15, rows[r].total_time);
+    }
+}
+void test_sweep_invalid(void) {
+    struct sweep_row rows[1];
+    TEST_ASSERT_EQUAL_INT(0, rr_sweep((int[]){5}, 1, 0, 3, 1, 1, rows));
+    TEST_ASSERT_EQUAL_INT(0, rr_sweep((int[]){5}, 1, 3, 2, 1, 1, rows));
+    TEST_ASSERT_EQUAL_INT(0, rr_sweep((int[]){5}, 1, 1, 2, 0, 1, rows));
+    TEST_ASSERT_EQUAL_INT(0, rr_sweep(NULL, 1, 1, 2, 1, 1, rows));
+}
+void test_sweep_matches_rr_run(void) {
+    srand(3400);
+    int plen = 500;
+    int* bursts = malloc(sizeof(int) * plen);
+    struct sweep_row* rows = malloc(sizeof(struct sweep_row) * 64);
+    TEST_ASSERT_NOT_NULL(bursts);
+    TEST_ASSERT_NOT_NULL(rows);
+    for (int i = 0; i < plen; i++) {
+        bursts[i] = 1 + rand() % 100;
+    }
+
+    TEST_ASSERT_EQUAL_INT(64, rr_sweep(bursts, plen, 1, 64, 1, 4, rows));
+    for (int r = 0; r < 64; r++) {
+        struct pcb* procs = init_procs(bursts, plen);
+        TEST_ASSERT_NOT_NULL(procs);
+        int total_time = rr_run(procs, plen, r + 1);
+        long long sum_wait = 0;
+        for (int i = 0; i < plen; i++) {
+            sum_wait += procs[i].wait;
+        }
+        TEST_ASSERT_EQUAL_INT(r + 1, rows[r].quantum);
+        TEST_ASSERT_EQUAL_INT64(total_time, rows[r].total_time);
+        TEST_ASSERT_EQUAL_FLOAT((double)sum_wait / plen, rows[r].avg_wait);
+        free(procs);
+    }
+    free(bursts);
+    free(rows);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_sweep582);
+    RUN_TEST(test_sweep_invalid);
+    RUN_TEST(test_sweep_matches_rr_run);
+
+    return UNITY_END();
+}
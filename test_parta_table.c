@@ -0,0 +1,92 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include "test_helpers.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb_table table;
+
+void setUp(void) {
+    // Code to execute at test start up
+    table = (struct pcb_table){ 0, NULL, NULL };
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    pcb_table_free(&table);
+}
+void test_table_init(void) {
+    // When
+    TEST_ASSERT_EQUAL_INT(0, pcb_table_init(&table, (int[]){5, 8, 2}, 3));
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(3, table.len);
+    TEST_ASSERT_EQUAL_INT(5, table.burst_left[0]);
+    TEST_ASSERT_EQUAL_INT(8, table.burst_left[1]);
+    TEST_ASSERT_EQUAL_INT(2, table.burst_left[2]);
+    TEST_ASSERT_EQUAL_INT(0, table.wait[0]);
+    TEST_ASSERT_EQUAL_INT(0, table.wait[2]);
+}
+void test_table_init_invalid(void) {
+    // When: a table still holding a released table's pointers
+    TEST_ASSERT_EQUAL_INT(0, pcb_table_init(&table, (int[]){5, 8, 2}, 3));
+    struct pcb_table stale = table;
+    TEST_ASSERT_EQUAL_INT(-1, pcb_table_init(&table, NULL, 3));
+    pcb_table_free(&stale);
+
+    // Then: it is left empty, so freeing it again is harmless
+    TEST_ASSERT_EQUAL_INT(0, table.len);
+    TEST_ASSERT_NULL(table.burst_left);
+    TEST_ASSERT_NULL(table.wait);
+    TEST_ASSERT_EQUAL_INT(-1, pcb_table_from_procs(&table, NULL, 3));
+    TEST_ASSERT_NULL(table.burst_left);
+}
+void test_table_run_proc(void) {
+    // Set up PCBs [5, 0, 2] current 2, amount 2
+    TEST_ASSERT_EQUAL_INT(0, pcb_table_init(&table, (int[]){5, 0, 2}, 3));
+    pcb_table_run_proc(&table, 2, 2);
+    TEST_ASSERT_EQUAL_INT(5, table.burst_left[0]);
+    TEST_ASSERT_EQUAL_INT(2, table.wait[0]);
+    TEST_ASSERT_EQUAL_INT(0, table.burst_left[1]);
+    TEST_ASSERT_EQUAL_INT(0, table.wait[1]);
+    TEST_ASSERT_EQUAL_INT(0, table.burst_left[2]);
+    TEST_ASSERT_EQUAL_INT(0, table.wait[2]);
+}
+void test_table_matches_run_proc(void) {
+    srand(3400);
+    for (int trial = 0; trial < 100; trial++) {
+        int plen = 1 + rand() % 100;
+        struct pcb* procs = random_workload(plen, 20, 5);
+        struct pcb* back = malloc(sizeof(struct pcb) * plen);
+        TEST_ASSERT_NOT_NULL(procs);
+        TEST_ASSERT_NOT_NULL(back);
+        TEST_ASSERT_EQUAL_INT(0, pcb_table_from_procs(&table, procs, plen));
+
+        for (int step = 0; step < 50; step++) {
+            int current = rand() % plen;
+            int amount = 1 + rand() % 6;
+            run_proc(procs, plen, current, amount);
+            pcb_table_run_proc(&table, current, amount);
+        }
+
+        pcb_table_to_procs(&table, back);
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(procs[i].pid, back[i].pid);
+            TEST_ASSERT_EQUAL_INT(procs[i].burst_left, back[i].burst_left);
+            TEST_ASSERT_EQUAL_INT(procs[i].wait, back[i].wait);
+        }
+        pcb_table_free(&table);
+        free(procs);
+        free(back);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_table_init);
+    RUN_TEST(test_table_init_invalid);
+    RUN_TEST(test_table_run_proc);
+    RUN_TEST(test_table_matches_run_proc);
+
+    return UNITY_END();
+}
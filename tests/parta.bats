@@ -99,3 +99,153 @@ EOF
     assert [ "$status" -eq 0 ]                             # Assert if exit status matches
 }
 
+@test "parta_main sweep rr 1:4 5 8 2" {
+    run parta_main sweep rr 1:4 5 8 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using RR sweep 1:4:1.
+
+ Quantum     Avg wait   Avg turnaround   Total time
+       1         5.67            10.67           15
+       2         5.67            10.67           15
+       3         6.00            11.00           15
+       4         7.00            12.00           15
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+@test "parta_main sweep rr 0:4 5" {
+    run parta_main sweep rr 0:4 5
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid quantum range
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main sweep rr 1:4:4294967297 5" {
+    run parta_main sweep rr 1:4:4294967297 5
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid quantum range
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+@test "parta_main sweep rr 1:4:2147483648 5" {
+    run parta_main sweep rr 1:4:2147483648 5
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid quantum range
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main fcfs - (stdin)" {
+    run bash -c "printf '5 8\n2\n' | parta_main fcfs -"
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using FCFS
+
+Accepted P0: Burst 5
+Accepted P1: Burst 8
+Accepted P2: Burst 2
+Average wait time: 6.00
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+@test "parta_main rr 2 --input - (invalid burst)" {
+    run bash -c "printf '5 8x 2\n' | parta_main rr 2 --input -"
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid burst
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+@test "parta_main convert and rr 2 --input (binary)" {
+    run bash -c "printf '5 8 2\n' | parta_main convert - \"$BATS_TEST_TMPDIR/582.wl\" && parta_main rr 2 --input \"$BATS_TEST_TMPDIR/582.wl\""
+
+    cat << EOF | assert_output -   # Assert if output matches
+Converted 3 bursts.
+Using RR(2).
+
+Accepted P0: Burst 5
+Accepted P1: Burst 8
+Accepted P2: Burst 2
+Average wait time: 5.67
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+@test "parta_main compress and fcfs - (compressed stdin)" {
+    run bash -c "printf '5 8 2\n' | parta_main compress - \"$BATS_TEST_TMPDIR/582.vz\" && parta_main fcfs - < \"$BATS_TEST_TMPDIR/582.vz\""
+
+    cat << EOF | assert_output -   # Assert if output matches
+Compressed 3 bursts.
+Using FCFS
+
+Accepted P0: Burst 5
+Accepted P1: Burst 8
+Accepted P2: Burst 2
+Average wait time: 6.00
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+@test "parta_main fcfs --threads 2 --input FILE" {
+    run bash -c "printf '5\n8\n2\n' > \"$BATS_TEST_TMPDIR/582.txt\" && parta_main fcfs --threads 2 --input \"$BATS_TEST_TMPDIR/582.txt\""
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using FCFS
+
+Accepted P0: Burst 5
+Accepted P1: Burst 8
+Accepted P2: Burst 2
+Average wait time: 6.00
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+@test "parta_main rr 2 --quiet 5 8 2" {
+    run parta_main rr 2 --quiet 5 8 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+Average wait time: 5.67
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+@test "parta_main fcfs --quiet --format jsonl --output - 5 8 2" {
+    run parta_main fcfs --quiet --format jsonl --output - 5 8 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+Average wait time: 6.00
+{"pid":0,"burst":5,"wait":0,"turnaround":5,"completion":5}
+{"pid":1,"burst":8,"wait":5,"turnaround":13,"completion":13}
+{"pid":2,"burst":2,"wait":13,"turnaround":15,"completion":15}
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+@test "parta_main rr 2 --quiet --stats 5 8 2" {
+    run parta_main rr 2 --quiet --stats 5 8 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+Average wait time: 5.67
+Wait time: mean 5.67, p50 6, p90 7, p99 7, p99.9 7, max 7
+Turnaround time: mean 10.67, p50 11, p90 15, p99 15, p99.9 15, max 15
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+@test "parta_main fcfs --input <(process substitution)" {
+    run bash -c "parta_main fcfs --input <(printf '5 8 2\n') && parta_main fcfs --threads 2 --input <(printf '5 8 2\n')"
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using FCFS
+
+Accepted P0: Burst 5
+Accepted P1: Burst 8
+Accepted P2: Burst 2
+Average wait time: 6.00
+Using FCFS
+
+Accepted P0: Burst 5
+Accepted P1: Burst 8
+Accepted P2: Burst 2
+Average wait time: 6.00
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}